@@ -0,0 +1,132 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+/*
+ * Compares the sample-major, stage-major and parallel processing
+ * strategies of Cascade for Butterworth low pass filters of order 2
+ * through 50.
+ *
+ * Prints nanoseconds per sample for each strategy, for a short block
+ * as used in real time audio and for a long buffer, where the tiled
+ * stage-major strategy keeps the working set in the L1 cache.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+enum
+{
+  maxOrder = 50,
+  totalSamples = 1 << 22,
+  tileSize = 512
+};
+
+typedef Dsp::SimpleFilter <Dsp::Butterworth::LowPass <maxOrder>, 1> filter_t;
+
+// Returns nanoseconds per sample
+double measure (filter_t& f, std::vector<float>& buffer, int blockSize)
+{
+  const int numBlocks = totalSamples / blockSize;
+  float* data = &buffer[0];
+
+  // warm up
+  f.process (blockSize, &data);
+  f.reset ();
+
+  const std::chrono::high_resolution_clock::time_point start =
+    std::chrono::high_resolution_clock::now ();
+
+  for (int i = 0; i < numBlocks; ++i)
+  {
+    float* block = data + (i * blockSize) % int (buffer.size ());
+    f.process (blockSize, &block);
+  }
+
+  const std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::high_resolution_clock::now () - start;
+
+  return elapsed.count () / (double (numBlocks) * blockSize);
+}
+
+void run (int blockSize)
+{
+  std::vector<float> buffer (blockSize);
+  for (size_t i = 0; i < buffer.size (); ++i)
+    buffer[i] = float (std::rand () / double (RAND_MAX) - 0.5);
+
+  std::printf ("\nblock size %d (ns/sample)\n", blockSize);
+  std::printf ("order  sample-major  stage-major  stage-major/%d  parallel\n",
+               int (tileSize));
+
+  for (int order = 2; order <= maxOrder; order += 2)
+  {
+    filter_t f;
+    f.setup (order, 44100, 1000);
+
+    f.setProcessing (Dsp::Cascade::sampleMajor);
+    const double sampleMajor = measure (f, buffer, blockSize);
+
+    f.setProcessing (Dsp::Cascade::stageMajor);
+    const double stageMajor = measure (f, buffer, blockSize);
+
+    f.setProcessing (Dsp::Cascade::stageMajor, tileSize);
+    const double tiled = measure (f, buffer, blockSize);
+
+    f.setProcessing (Dsp::Cascade::parallel);
+    const double parallel = measure (f, buffer, blockSize);
+
+    // poorly conditioned expansions run as a cascade
+    std::printf ("%5d  %12.2f  %11.2f  %15.2f  %8.2f%s\n",
+                 order, sampleMajor, stageMajor, tiled, parallel,
+                 f.usesParallel (0.) ? "" : " (cascade)");
+  }
+}
+
+}
+
+int main ()
+{
+  run (256);
+  run (65536);
+
+  return 0;
+}
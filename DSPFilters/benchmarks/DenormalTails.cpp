@@ -0,0 +1,157 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+/*
+ * Measures the cost of the decaying tail of a filter after an impulse,
+ * under the denormal strategy the library was compiled with.
+ *
+ * The Makefile builds this twice. DenormalTails uses the default small
+ * alternating offset, and DenormalTailsFlush defines
+ * DSPFILTERS_FLUSH_DENORMALS so that processing runs in flush to zero
+ * mode instead. The flush build also runs the filter through the
+ * Cascade directly, outside of any guard, to show what the tail costs
+ * with no protection at all.
+ *
+ * Prints nanoseconds per sample over the tail, and over white noise
+ * where denormals never occur, for low pass filters with a long decay
+ * in double and single precision state.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+enum
+{
+  order = 8,
+  blockSize = 256,
+  tailSamples = 1 << 18,
+  repetitions = 8
+};
+
+typedef Dsp::Butterworth::LowPass <order> design_t;
+
+const double cutoffFrequency = 40;
+
+// Fills the buffer with an impulse followed by silence, or with noise
+void fill (std::vector<float>& buffer, bool noise)
+{
+  for (size_t i = 0; i < buffer.size (); ++i)
+    buffer[i] = noise ? float (std::rand () / double (RAND_MAX) - 0.5) : 0.f;
+
+  if (!noise)
+    buffer[0] = 1;
+}
+
+// Returns nanoseconds per sample. Through the SimpleFilter when
+// guarded, otherwise straight through the Cascade.
+template <class StateType>
+double measure (bool noise, bool guarded)
+{
+  Dsp::SimpleFilter <design_t, 1, StateType> f;
+  f.setup (order, 44100, cutoffFrequency);
+
+  typename design_t::template State <StateType> state;
+
+  std::vector<float> buffer (tailSamples);
+  std::vector<float> source (tailSamples);
+  fill (source, noise);
+
+  std::chrono::duration<double, std::nano> elapsed (0);
+
+  for (int r = 0; r < repetitions; ++r)
+  {
+    buffer = source;
+    f.reset ();
+    state.reset ();
+
+    const std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now ();
+
+    for (int offset = 0; offset < tailSamples; offset += blockSize)
+    {
+      float* block = &buffer[offset];
+      if (guarded)
+        f.process (int (blockSize), &block);
+      else
+        static_cast<design_t&> (f).process (int (blockSize), block, state);
+    }
+
+    elapsed += std::chrono::high_resolution_clock::now () - start;
+  }
+
+  return elapsed.count () / (double (repetitions) * tailSamples);
+}
+
+template <class StateType>
+void run (const char* name)
+{
+#ifdef DSPFILTERS_FLUSH_DENORMALS
+  std::printf ("%-24s  %12.2f  %10.2f  %12.2f\n", name,
+               measure <StateType> (false, true),
+               measure <StateType> (true, true),
+               measure <StateType> (false, false));
+#else
+  std::printf ("%-24s  %12.2f  %10.2f\n", name,
+               measure <StateType> (false, true),
+               measure <StateType> (true, true));
+#endif
+}
+
+}
+
+int main ()
+{
+#ifdef DSPFILTERS_FLUSH_DENORMALS
+  std::printf ("flush to zero (ns/sample)\n");
+  std::printf ("state                     impulse tail       noise  "
+               "tail, no guard\n");
+#else
+  std::printf ("alternating offset (ns/sample)\n");
+  std::printf ("state                     impulse tail       noise\n");
+#endif
+
+  run <Dsp::DirectFormII> ("DirectFormII");
+  run <Dsp::BasicDirectFormII <float> > ("BasicDirectFormII<float>");
+  run <Dsp::TransposedDirectFormII> ("TransposedDirectFormII");
+
+  return 0;
+}
@@ -0,0 +1,541 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+/*
+ * Measures processing throughput over every combination of filter
+ * family, kind, order, state realization, channel count and layout,
+ * sample type and block size, and writes the results as JSON.
+ *
+ * Usage: dspfilters_bench [option value]...
+ *
+ *   --family    Butterworth,ChebyshevI,ChebyshevII,Elliptic,Bessel,
+ *               Legendre,RBJ
+ *   --kind      LowPass,HighPass,BandPass,BandStop,LowShelf,HighShelf,
+ *               BandShelf,BandPass1,BandPass2,AllPass
+ *   --order     2-50            orders, RBJ is always order 2
+ *   --state     DirectFormI,DirectFormII,TransposedDirectFormI,
+ *               TransposedDirectFormII, and each with a "<float>" suffix
+ *   --channels  1,2,8,32
+ *   --layout    dynamic,fixed   channel count set at run time, or given
+ *               as the Channels template argument, which only covers
+ *               1, 2, 8 and 32 channels
+ *   --sample    float,double
+ *   --block     32-8192         powers of two in a range
+ *   --frames    32768           frames processed per measurement
+ *   --output    file            instead of the standard output
+ *
+ * Every list option takes names or values separated by commas, and
+ * defaults to everything shown. The whole set is well over a million
+ * measurements, so narrow it down for anything but an overnight run.
+ * Progress goes to the standard error.
+ *
+ * Each result holds the nanoseconds per sample and samples per second,
+ * counting every channel, and whether the output stayed finite. Designs
+ * which are not numerically sound at high orders show up there.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum
+{
+  maxOrder = 50
+};
+
+//------------------------------------------------------------------------------
+
+const char* const stateNames [] =
+{
+  "DirectFormI",
+  "DirectFormII",
+  "TransposedDirectFormI",
+  "TransposedDirectFormII",
+  "DirectFormI<float>",
+  "DirectFormII<float>",
+  "TransposedDirectFormI<float>",
+  "TransposedDirectFormII<float>"
+};
+
+const int numStates = sizeof (stateNames) / sizeof (stateNames[0]);
+
+const char* const layoutNames [] =
+{
+  "dynamic",
+  "fixed"
+};
+
+const int numLayouts = sizeof (layoutNames) / sizeof (layoutNames[0]);
+
+template <class DesignClass, class StateType>
+Dsp::Filter* createWithState (int numChannels, bool fixed)
+{
+  if (fixed)
+  {
+    switch (numChannels)
+    {
+    case 1: return new Dsp::FilterDesign <DesignClass, 1, StateType>;
+    case 2: return new Dsp::FilterDesign <DesignClass, 2, StateType>;
+    case 8: return new Dsp::FilterDesign <DesignClass, 8, StateType>;
+    case 32: return new Dsp::FilterDesign <DesignClass, 32, StateType>;
+    };
+
+    return 0;
+  }
+
+  Dsp::FilterDesign <DesignClass, Dsp::dynamicChannels, StateType>* f =
+    new Dsp::FilterDesign <DesignClass, Dsp::dynamicChannels, StateType>;
+  f->setNumChannels (numChannels);
+  return f;
+}
+
+// Returns 0 for a fixed layout with a channel count not listed above
+template <class DesignClass>
+Dsp::Filter* create (int state, int numChannels, bool fixed)
+{
+  switch (state)
+  {
+  case 0: return createWithState <DesignClass, Dsp::DirectFormI> (numChannels, fixed);
+  case 1: return createWithState <DesignClass, Dsp::DirectFormII> (numChannels, fixed);
+  case 2: return createWithState <DesignClass, Dsp::TransposedDirectFormI> (numChannels, fixed);
+  case 3: return createWithState <DesignClass, Dsp::TransposedDirectFormII> (numChannels, fixed);
+  case 4: return createWithState <DesignClass, Dsp::BasicDirectFormI <float> > (numChannels, fixed);
+  case 5: return createWithState <DesignClass, Dsp::BasicDirectFormII <float> > (numChannels, fixed);
+  case 6: return createWithState <DesignClass, Dsp::BasicTransposedDirectFormI <float> > (numChannels, fixed);
+  case 7: return createWithState <DesignClass, Dsp::BasicTransposedDirectFormII <float> > (numChannels, fixed);
+  };
+
+  return 0;
+}
+
+struct Design
+{
+  const char* family;
+  const char* kind;
+  bool hasOrder;
+  Dsp::Filter* (*create) (int state, int numChannels, bool fixed);
+};
+
+#define DESIGN(family, kind) \
+  { #family, #kind, true, create <Dsp::family::Design::kind <maxOrder> > }
+
+#define RBJ_DESIGN(kind) \
+  { "RBJ", #kind, false, create <Dsp::RBJ::Design::kind> }
+
+const Design designs [] =
+{
+  DESIGN (Butterworth, LowPass),
+  DESIGN (Butterworth, HighPass),
+  DESIGN (Butterworth, BandPass),
+  DESIGN (Butterworth, BandStop),
+  DESIGN (Butterworth, LowShelf),
+  DESIGN (Butterworth, HighShelf),
+  DESIGN (Butterworth, BandShelf),
+
+  DESIGN (ChebyshevI, LowPass),
+  DESIGN (ChebyshevI, HighPass),
+  DESIGN (ChebyshevI, BandPass),
+  DESIGN (ChebyshevI, BandStop),
+  DESIGN (ChebyshevI, LowShelf),
+  DESIGN (ChebyshevI, HighShelf),
+  DESIGN (ChebyshevI, BandShelf),
+
+  DESIGN (ChebyshevII, LowPass),
+  DESIGN (ChebyshevII, HighPass),
+  DESIGN (ChebyshevII, BandPass),
+  DESIGN (ChebyshevII, BandStop),
+  DESIGN (ChebyshevII, LowShelf),
+  DESIGN (ChebyshevII, HighShelf),
+  DESIGN (ChebyshevII, BandShelf),
+
+  DESIGN (Elliptic, LowPass),
+  DESIGN (Elliptic, HighPass),
+  DESIGN (Elliptic, BandPass),
+  DESIGN (Elliptic, BandStop),
+
+  DESIGN (Bessel, LowPass),
+  DESIGN (Bessel, HighPass),
+  DESIGN (Bessel, BandPass),
+  DESIGN (Bessel, BandStop),
+  DESIGN (Bessel, LowShelf),
+
+  DESIGN (Legendre, LowPass),
+  DESIGN (Legendre, HighPass),
+  DESIGN (Legendre, BandPass),
+  DESIGN (Legendre, BandStop),
+
+  RBJ_DESIGN (LowPass),
+  RBJ_DESIGN (HighPass),
+  RBJ_DESIGN (BandPass1),
+  RBJ_DESIGN (BandPass2),
+  RBJ_DESIGN (BandStop),
+  RBJ_DESIGN (LowShelf),
+  RBJ_DESIGN (HighShelf),
+  RBJ_DESIGN (BandShelf),
+  RBJ_DESIGN (AllPass)
+};
+
+#undef DESIGN
+#undef RBJ_DESIGN
+
+const int numDesigns = sizeof (designs) / sizeof (designs[0]);
+
+//------------------------------------------------------------------------------
+
+// The selection made on the command line
+struct Options
+{
+  Options ()
+    : frames (32768)
+    , output (0)
+  {
+  }
+
+  std::vector<std::string> families;
+  std::vector<std::string> kinds;
+  std::vector<std::string> states;
+  std::vector<std::string> samples;
+  std::vector<int> orders;
+  std::vector<int> channels;
+  std::vector<std::string> layouts;
+  std::vector<int> blocks;
+  int frames;
+  const char* output;
+};
+
+std::vector<std::string> split (const char* list)
+{
+  std::vector<std::string> items;
+  std::string item;
+
+  for (const char* p = list; ; ++p)
+  {
+    if (*p == ',' || *p == 0)
+    {
+      if (!item.empty ())
+        items.push_back (item);
+      item.clear ();
+      if (*p == 0)
+        break;
+    }
+    else
+    {
+      item += *p;
+    }
+  }
+
+  return items;
+}
+
+// Values and ranges such as "1,2,8" or "2-50". With powersOfTwo,
+// a range only includes the powers of two inside it.
+std::vector<int> parseValues (const char* list, bool powersOfTwo)
+{
+  std::vector<int> values;
+  const std::vector<std::string> items = split (list);
+
+  for (size_t i = 0; i < items.size (); ++i)
+  {
+    const char* item = items[i].c_str ();
+    const char* dash = std::strchr (item, '-');
+    const int first = std::atoi (item);
+    const int last = dash ? std::atoi (dash + 1) : first;
+
+    for (int v = first; v <= last; ++v)
+      if (!dash || !powersOfTwo || (v > 0 && (v & (v - 1)) == 0))
+        values.push_back (v);
+  }
+
+  return values;
+}
+
+bool contains (const std::vector<std::string>& list, const char* name)
+{
+  for (size_t i = 0; i < list.size (); ++i)
+    if (list[i] == name)
+      return true;
+
+  return false;
+}
+
+bool parseOptions (int argc, char** argv, Options& options)
+{
+  options.families = split ("Butterworth,ChebyshevI,ChebyshevII,Elliptic,"
+                            "Bessel,Legendre,RBJ");
+  options.kinds = split ("LowPass,HighPass,BandPass,BandStop,LowShelf,"
+                         "HighShelf,BandShelf,BandPass1,BandPass2,AllPass");
+  options.states.assign (stateNames, stateNames + numStates);
+  options.samples = split ("float,double");
+  options.orders = parseValues ("2-50", false);
+  options.channels = parseValues ("1,2,8,32", false);
+  options.layouts.assign (layoutNames, layoutNames + numLayouts);
+  options.blocks = parseValues ("32-8192", true);
+
+  for (int i = 1; i < argc; i += 2)
+  {
+    const std::string name = argv[i];
+    if (i + 1 >= argc)
+    {
+      std::fprintf (stderr, "missing value for %s\n", name.c_str ());
+      return false;
+    }
+
+    const char* value = argv[i + 1];
+
+    if (name == "--family")
+      options.families = split (value);
+    else if (name == "--kind")
+      options.kinds = split (value);
+    else if (name == "--order")
+      options.orders = parseValues (value, false);
+    else if (name == "--state")
+      options.states = split (value);
+    else if (name == "--channels")
+      options.channels = parseValues (value, false);
+    else if (name == "--layout")
+      options.layouts = split (value);
+    else if (name == "--sample")
+      options.samples = split (value);
+    else if (name == "--block")
+      options.blocks = parseValues (value, true);
+    else if (name == "--frames")
+      options.frames = std::atoi (value);
+    else if (name == "--output")
+      options.output = value;
+    else
+    {
+      std::fprintf (stderr, "unknown option %s\n", name.c_str ());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+
+struct Result
+{
+  double nanosecondsPerSample;
+  double samplesPerSecond;
+  bool finite;
+};
+
+// Processes numFrames frames of noise in blocks, continuing on through
+// the same buffer so that the filter always sees a running signal.
+template <typename Sample>
+Result measure (Dsp::Filter& f, int numChannels, int blockSize, int numFrames)
+{
+  const int length = std::max (blockSize, 8192);
+  std::vector<Sample> buffer (size_t (numChannels) * length);
+  for (size_t i = 0; i < buffer.size (); ++i)
+    buffer[i] = Sample (std::rand () / double (RAND_MAX) - 0.5);
+
+  std::vector<Sample*> channels (numChannels);
+  for (int c = 0; c < numChannels; ++c)
+    channels[c] = &buffer[size_t (c) * length];
+
+  const int numBlocks = std::max (1, numFrames / blockSize);
+  std::vector<Sample*> block (numChannels);
+
+  // warm up
+  f.process (blockSize, &channels[0]);
+  f.reset ();
+
+  const std::chrono::high_resolution_clock::time_point start =
+    std::chrono::high_resolution_clock::now ();
+
+  for (int i = 0; i < numBlocks; ++i)
+  {
+    const int offset = (i * blockSize) % length;
+    for (int c = 0; c < numChannels; ++c)
+      block[c] = channels[c] + offset;
+    f.process (blockSize, &block[0]);
+  }
+
+  const std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::high_resolution_clock::now () - start;
+
+  Result result;
+  const double numSamples = double (numBlocks) * blockSize * numChannels;
+  result.nanosecondsPerSample = elapsed.count () / numSamples;
+  result.samplesPerSecond = numSamples / (elapsed.count () * 1e-9);
+  result.finite = true;
+  for (size_t i = 0; i < buffer.size (); ++i)
+    if (!(std::fabs (double (buffer[i])) <= DBL_MAX))
+      result.finite = false;
+
+  return result;
+}
+
+const char* instructionSet ()
+{
+#if defined(DSPFILTERS_AVX)
+  return "avx";
+#elif defined(DSPFILTERS_SSE2)
+  return "sse2";
+#else
+  return "none";
+#endif
+}
+
+}
+
+//------------------------------------------------------------------------------
+
+int main (int argc, char** argv)
+{
+  Options options;
+  if (!parseOptions (argc, argv, options))
+    return 1;
+
+  FILE* out = stdout;
+  if (options.output)
+  {
+    out = std::fopen (options.output, "w");
+    if (!out)
+    {
+      std::fprintf (stderr, "can't open %s\n", options.output);
+      return 1;
+    }
+  }
+
+  std::fprintf (out, "{\n");
+  std::fprintf (out, "  \"benchmark\": \"dspfilters_bench\",\n");
+  std::fprintf (out, "  \"instructionSet\": \"%s\",\n", instructionSet ());
+#ifdef DSPFILTERS_FLUSH_DENORMALS
+  std::fprintf (out, "  \"flushDenormals\": true,\n");
+#else
+  std::fprintf (out, "  \"flushDenormals\": false,\n");
+#endif
+  std::fprintf (out, "  \"framesPerMeasurement\": %d,\n", options.frames);
+  std::fprintf (out, "  \"results\": [");
+
+  int count = 0;
+
+  for (int d = 0; d < numDesigns; ++d)
+  {
+    const Design& design = designs[d];
+    if (!contains (options.families, design.family) ||
+        !contains (options.kinds, design.kind))
+      continue;
+
+    std::fprintf (stderr, "%s %s\n", design.family, design.kind);
+
+    for (size_t o = 0; o < options.orders.size (); ++o)
+    {
+      const int order = design.hasOrder ? options.orders[o] : 2;
+      if (design.hasOrder ? (order < 1 || order > maxOrder) : o > 0)
+        continue;
+
+      for (int s = 0; s < numStates; ++s)
+      {
+        if (!contains (options.states, stateNames[s]))
+          continue;
+
+        for (size_t c = 0; c < options.channels.size (); ++c)
+        {
+          const int numChannels = options.channels[c];
+          if (numChannels < 1)
+            continue;
+
+          for (int l = 0; l < numLayouts; ++l)
+          {
+            if (!contains (options.layouts, layoutNames[l]))
+              continue;
+
+            Dsp::Filter* f = design.create (s, numChannels, l == 1);
+            if (!f)
+              continue;
+
+            Dsp::Params params = f->getDefaultParams ();
+            const int orderIndex = f->findParamId (Dsp::idOrder);
+            if (orderIndex >= 0)
+              params[orderIndex] = order;
+            f->setParams (params);
+
+            for (size_t t = 0; t < options.samples.size (); ++t)
+            {
+              const bool isFloat = options.samples[t] == "float";
+              if (!isFloat && options.samples[t] != "double")
+                continue;
+
+              for (size_t b = 0; b < options.blocks.size (); ++b)
+              {
+                const int blockSize = options.blocks[b];
+                if (blockSize < 1)
+                  continue;
+
+                f->reset ();
+                const Result r = isFloat ?
+                  measure <float> (*f, numChannels, blockSize, options.frames) :
+                  measure <double> (*f, numChannels, blockSize, options.frames);
+
+                std::fprintf (out,
+                  "%s\n    {\"family\": \"%s\", \"kind\": \"%s\", \"order\": %d, "
+                  "\"state\": \"%s\", \"channels\": %d, \"layout\": \"%s\", "
+                  "\"sample\": \"%s\", \"blockSize\": %d, \"nsPerSample\": %.4f, "
+                  "\"samplesPerSecond\": %.0f, \"finite\": %s}",
+                  count++ > 0 ? "," : "",
+                  design.family, design.kind, order, stateNames[s],
+                  numChannels, layoutNames[l], isFloat ? "float" : "double",
+                  blockSize, r.nanosecondsPerSample, r.samplesPerSecond,
+                  r.finite ? "true" : "false");
+              }
+            }
+
+            delete f;
+          }
+        }
+      }
+    }
+  }
+
+  std::fprintf (out, "\n  ]\n}\n");
+
+  if (out != stdout)
+    std::fclose (out);
+
+  return 0;
+}
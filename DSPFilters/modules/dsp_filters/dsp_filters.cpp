@@ -40,9 +40,11 @@ THE SOFTWARE.
 #pragma warning (disable: 4702) // unreachable code
 #endif
 
+#include "filters/Arena.cpp"
 #include "filters/Bessel.cpp"
 #include "filters/Biquad.cpp"
 #include "filters/Butterworth.cpp"
+#include "filters/Cache.cpp"
 #include "filters/Cascade.cpp"
 #include "filters/ChebyshevI.cpp"
 #include "filters/ChebyshevII.cpp"
@@ -52,11 +54,15 @@ THE SOFTWARE.
 #include "filters/Elliptic.cpp"
 #include "filters/Filter.cpp"
 #include "filters/Legendre.cpp"
+#include "filters/Oversampler.cpp"
 #include "filters/Param.cpp"
 #include "filters/PoleFilter.cpp"
+#include "filters/PoleTables.cpp"
 #include "filters/RBJ.cpp"
+#include "filters/Response.cpp"
 #include "filters/RootFinder.cpp"
 #include "filters/State.cpp"
+#include "filters/WorkerPool.cpp"
 
 #ifdef _MSC_VER
 #pragma warning (pop)
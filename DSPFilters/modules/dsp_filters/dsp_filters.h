@@ -38,6 +38,7 @@ THE SOFTWARE.
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
@@ -46,6 +47,7 @@ THE SOFTWARE.
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <new>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -66,14 +68,24 @@ namespace tr1 = std;
 #include "filters/RootFinder.h"
 #include "filters/Types.h"
 #include "filters/Utilities.h"
+#include "filters/Simd.h"
+#include "filters/Arena.h"
 
 #include "filters/Biquad.h"
 #include "filters/Layout.h"
 #include "filters/Cascade.h"
+#include "filters/Response.h"
+#include "filters/Cache.h"
 #include "filters/PoleFilter.h"
+#include "filters/PoleTables.h"
 #include "filters/Params.h"
 #include "filters/Design.h"
+#include "filters/WorkerPool.h"
 #include "filters/State.h"
+#include "filters/FilterBank.h"
+#include "filters/VoiceBank.h"
+#include "filters/ZeroPhase.h"
+#include "filters/SegmentedFilter.h"
 
 #include "filters/Bessel.h"
 #include "filters/Butterworth.h"
@@ -86,6 +98,7 @@ namespace tr1 = std;
 
 #include "filters/Filter.h"
 #include "filters/SmoothedFilter.h"
+#include "filters/Oversampler.h"
 
 #ifdef _MSC_VER
 #pragma warning (pop)
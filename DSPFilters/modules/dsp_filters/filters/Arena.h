@@ -0,0 +1,106 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_ARENA_H
+#define DSPFILTERS_ARENA_H
+
+namespace Dsp {
+
+/*
+ * Memory supplied by the caller, handed out in order
+ *
+ * Storage whose size is only known at run time, such as the stages
+ * of a SizedFilter, is carved out of the block one allocation after
+ * the other. Nothing is freed on its own; clear() makes the whole
+ * block available again, after which everything allocated from it
+ * must no longer be used. The block is not owned by the arena and
+ * must outlive everything allocated from it.
+ *
+ * Only objects which need no destructor are placed in an arena.
+ *
+ */
+
+class Arena
+{
+public:
+  enum
+  {
+    // Every allocation starts on a multiple of this, which
+    // suits doubles and the vectors of the lane processing.
+    alignment = 16
+  };
+
+  Arena (void* memory, size_t bytes);
+
+  // Throws std::bad_alloc if the block has too little room left
+  void* allocate (size_t bytes);
+
+  // Default constructs an array of objects
+  template <class Object>
+  Object* allocateArray (int count)
+  {
+    assert (count >= 0);
+    Object* objects = static_cast<Object*> (
+      allocate (count * sizeof (Object)));
+    for (int i = 0; i < count; ++i)
+      new (objects + i) Object;
+    return objects;
+  }
+
+  void clear ();
+
+  size_t getBytesUsed () const
+  {
+    return m_next - m_begin;
+  }
+
+  size_t getBytesFree () const
+  {
+    return m_end - m_next;
+  }
+
+private:
+  Arena (const Arena&);
+  Arena& operator= (const Arena&);
+
+private:
+  char* m_begin;
+  char* m_end;
+  char* m_next;
+};
+
+}
+
+#endif
@@ -72,6 +72,13 @@ void AnalogLowPass::design (int numPoles,
   {
     m_numPoles = numPoles;
 
+    if (analogPoles.design (*this, numPoles))
+      return;
+
+    const DesignKey key ("Bessel Analog Low Pass", numPoles);
+    if (DesignCache::findLayout (key, *this))
+      return;
+
     reset ();
 
     RootFinderBase& solver (w->roots);
@@ -88,6 +95,8 @@ void AnalogLowPass::design (int numPoles,
 
     if (numPoles & 1)
       add (solver.root()[pairs].real(), infinity());
+
+    DesignCache::storeLayout (key, *this);
   }
 }
 
@@ -109,14 +118,23 @@ void AnalogLowShelf::design (int numPoles,
     m_numPoles = numPoles;
     m_gainDb = gainDb;
 
+    const DesignKey key ("Bessel Analog Low Shelf", numPoles, gainDb);
+    if (DesignCache::findLayout (key, *this))
+      return;
+
     reset ();
 
     const double G = pow (10., gainDb / 20) - 1;
 
+    // the poles are those of the low pass
+    const double* table = analogPoles.getPoles (numPoles);
     RootFinderBase& poles (w->roots);
-    for (int i = 0; i < numPoles + 1; ++i)
-      poles.coef()[i] = reversebessel (i, numPoles);
-    poles.solve (numPoles);
+    if (!table)
+    {
+      for (int i = 0; i < numPoles + 1; ++i)
+        poles.coef()[i] = reversebessel (i, numPoles);
+      poles.solve (numPoles);
+    }
 
     RootFinder<50> zeros;
     for (int i = 0; i < numPoles + 1; ++i)
@@ -128,13 +146,17 @@ void AnalogLowShelf::design (int numPoles,
     const int pairs = numPoles / 2;
     for (int i = 0; i < pairs; ++i)
     {
-      complex_t p = poles.root()[i];
+      complex_t p = table ? complex_t (table[2*i], table[2*i+1])
+                          : poles.root()[i];
       complex_t z = zeros.root()[i];
       addPoleZeroConjugatePairs (p, z);
     }
 
     if (numPoles & 1)
-      add (poles.root()[pairs].real(), zeros.root()[pairs].real());
+      add (table ? table[2*pairs] : poles.root()[pairs].real(),
+           zeros.root()[pairs].real());
+
+    DesignCache::storeLayout (key, *this);
   }
 }
 
@@ -145,6 +167,10 @@ void LowPassBase::setup (int order,
                          double cutoffFrequency,
                          WorkspaceBase* w)
 {
+  const DesignKey key ("Bessel Low Pass", order, cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -152,6 +178,8 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
@@ -159,6 +187,10 @@ void HighPassBase::setup (int order,
                           double cutoffFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Bessel High Pass", order, cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -166,6 +198,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -174,6 +208,11 @@ void BandPassBase::setup (int order,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Bessel Band Pass", order, centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -182,6 +221,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -190,6 +231,11 @@ void BandStopBase::setup (int order,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Bessel Band Stop", order, centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -198,6 +244,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void LowShelfBase::setup (int order,
@@ -206,6 +254,11 @@ void LowShelfBase::setup (int order,
                           double gainDb,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Bessel Low Shelf", order, cutoffFrequency / sampleRate,
+                       gainDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -213,6 +266,8 @@ void LowShelfBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
@@ -75,6 +75,9 @@ private:
 
 //------------------------------------------------------------------------------
 
+// Poles of the low pass prototype, which the low shelf shares
+extern const PoleTable analogPoles;
+
 // Half-band analog prototypes (s-plane)
 
 class AnalogLowPass : public LayoutBase
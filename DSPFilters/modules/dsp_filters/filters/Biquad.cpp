@@ -197,6 +197,18 @@ void BiquadBase::setTwoPole (complex_t pole1, complex_t zero1,
   setCoefficients (a0, a1, a2, b0, b1, b2);
 }
 
+void BiquadBase::interpolate (const BiquadBase& from,
+                              const BiquadBase& to,
+                              double t)
+{
+  m_a0 = from.m_a0 + (to.m_a0 - from.m_a0) * t;
+  m_a1 = from.m_a1 + (to.m_a1 - from.m_a1) * t;
+  m_a2 = from.m_a2 + (to.m_a2 - from.m_a2) * t;
+  m_b0 = from.m_b0 + (to.m_b0 - from.m_b0) * t;
+  m_b1 = from.m_b1 + (to.m_b1 - from.m_b1) * t;
+  m_b2 = from.m_b2 + (to.m_b2 - from.m_b2) * t;
+}
+
 void BiquadBase::setPoleZeroForm (const BiquadPoleState& bps)
 {
   setPoleZeroPair (bps);
@@ -40,6 +40,153 @@ namespace Dsp {
 
 struct BiquadPoleState;
 
+/*
+ * Coefficients of a second order section, in the precision used
+ * to process samples. All but m_a0 are stored divided by a0.
+ *
+ */
+
+template <typename Value>
+struct BiquadCoefficients
+{
+  BiquadCoefficients ()
+  {
+  }
+
+  template <typename Other>
+  explicit BiquadCoefficients (const BiquadCoefficients <Other>& c)
+    : m_a0 (static_cast<Value> (c.m_a0))
+    , m_a1 (static_cast<Value> (c.m_a1))
+    , m_a2 (static_cast<Value> (c.m_a2))
+    , m_b1 (static_cast<Value> (c.m_b1))
+    , m_b2 (static_cast<Value> (c.m_b2))
+    , m_b0 (static_cast<Value> (c.m_b0))
+  {
+  }
+
+  Value m_a0;
+  Value m_a1;
+  Value m_a2;
+  Value m_b1;
+  Value m_b2;
+  Value m_b0;
+};
+
+// Precision of the coefficients used with state of the given
+// precision. Filters are designed in double precision, so only
+// single precision state gets coefficients of its own.
+template <typename Value>
+struct CoefficientPrecision
+{
+  typedef double type;
+};
+
+template <>
+struct CoefficientPrecision <float>
+{
+  typedef float type;
+};
+
+// Coefficients of many second order sections laid out as a structure
+// of arrays, one array for each coefficient, with element i of every
+// array belonging to section i. Like BiquadCoefficients, they are
+// divided by a0. The arrays are not owned.
+template <typename Value>
+struct BiquadArrays
+{
+  BiquadArrays ()
+    : m_a1 (0), m_a2 (0), m_b0 (0), m_b1 (0), m_b2 (0)
+  {
+  }
+
+  // Carves the five arrays for count sections out of one block of
+  // 5 * count values.
+  BiquadArrays (Value* storage, int count)
+    : m_a1 (storage)
+    , m_a2 (storage + count)
+    , m_b0 (storage + 2 * count)
+    , m_b1 (storage + 3 * count)
+    , m_b2 (storage + 4 * count)
+  {
+  }
+
+  template <typename Coefficient>
+  BiquadCoefficients <Coefficient> get (int index) const
+  {
+    BiquadCoefficients <Coefficient> s;
+    s.m_a0 = 1;
+    s.m_a1 = static_cast<Coefficient> (m_a1[index]);
+    s.m_a2 = static_cast<Coefficient> (m_a2[index]);
+    s.m_b0 = static_cast<Coefficient> (m_b0[index]);
+    s.m_b1 = static_cast<Coefficient> (m_b1[index]);
+    s.m_b2 = static_cast<Coefficient> (m_b2[index]);
+    return s;
+  }
+
+  Value* m_a1;
+  Value* m_a2;
+  Value* m_b0;
+  Value* m_b1;
+  Value* m_b2;
+};
+
+// Samples after which the response of second order sections to their
+// initial state has decayed by the given factor, judged by the pole
+// nearest the unit circle. Sections which are unstable, or have a pole
+// on the unit circle, never forget and give size_t (-1).
+template <typename Value>
+size_t decayLength (int numSections,
+                    const BiquadCoefficients <Value>* sections,
+                    double factor)
+{
+  double radius = 0;
+  for (int j = 0; j < numSections; ++j)
+  {
+    const double a1 = sections[j].m_a1;
+    const double a2 = sections[j].m_a2;
+    const double d = a1 * a1 - 4 * a2;
+    if (d < 0)
+      radius = std::max (radius, std::sqrt (a2));
+    else
+      radius = std::max (radius, (std::fabs (a1) + std::sqrt (d)) / 2);
+  }
+
+  if (radius >= 1)
+    return size_t (-1);
+
+  // each section holds two samples even without feedback
+  size_t length = 2 * numSections;
+  if (radius > 0)
+    length += size_t (std::ceil (std::log (factor) / std::log (radius)));
+  return length;
+}
+
+// Runs samples in place through the sections, one section at a time,
+// starting from the given states and leaving them updated. There is no
+// anti-denormal offset, hold a ScopedFlushDenormals instead.
+template <class StateType>
+void processSections (size_t numSamples,
+                      typename StateType::value_t* data,
+                      int numSections,
+                      const BiquadCoefficients <typename StateType::coefficient_t>* sections,
+                      StateType* states)
+{
+  typedef typename StateType::value_t value_t;
+
+  for (int j = 0; j < numSections; ++j)
+  {
+    const BiquadCoefficients <typename StateType::coefficient_t> s = sections[j];
+    StateType state = states[j];
+
+    for (size_t i = 0; i < numSamples; ++i)
+      data[i] = state.process1 (data[i], s, value_t (0));
+
+    states[j] = state;
+  }
+}
+
+//------------------------------------------------------------------------------
+
 /*
  * Holds coefficients for a second order Infinite Impulse Response
  * digital filter. This is the building block for all IIR filters.
@@ -47,17 +194,67 @@ struct BiquadPoleState;
  */
 
 // Factored interface to prevent outsiders from fiddling
-class BiquadBase
+class BiquadBase : public BiquadCoefficients <double>
 {
 public:
   template <class StateType>
   struct State : StateType, private DenormalPrevention
   {
-    template <typename Sample>
-    inline Sample process (const Sample in, const BiquadBase& b)
+    enum
+    {
+      supportsLanes = LaneTraits <StateType>::supported
+    };
+
+    // The biquad's own coefficients serve every precision
+    static void attach (BiquadBase&)
+    {
+    }
+
+    template <typename Sample, typename Coefficient>
+    inline Sample process (const Sample in,
+                           const BiquadCoefficients <Coefficient>& b)
     {
       return static_cast<Sample> (StateType::process1 (in, b, ac()));
     }
+
+    // Process a group of channels which share the biquad,
+    // one channel in each lane of Vector.
+    template <class Vector, class DesignState, class Channels>
+    static void processLanes (int numSamples,
+                              const Channels& dest,
+                              DesignState* states,
+                              const BiquadBase& b)
+    {
+      if (numSamples <= 0)
+        return;
+
+      typename StateType::template Lanes <Vector> lanes (b);
+
+      Vector vsa;
+      for (int l = 0; l < Vector::lanes; ++l)
+      {
+        State& state = states[l];
+        lanes.load (l, state);
+        vsa.set (l, state.ac ());
+        if (!(numSamples & 1))
+          state.ac ();
+      }
+
+      for (int i = 0; i < numSamples; ++i)
+      {
+        Vector v;
+        v.load (dest, i);
+        v = lanes.process1 (v, vsa);
+        v.store (dest, i);
+        vsa = -vsa;
+      }
+
+      for (int l = 0; l < Vector::lanes; ++l)
+      {
+        State& state = states[l];
+        lanes.store (l, state);
+      }
+    }
   };
 
 public:
@@ -73,12 +270,18 @@ public:
   double getB1 () const { return m_b1*m_a0; }
   double getB2 () const { return m_b2*m_a0; }
 
+  // Sets the coefficients to a point on the straight line between
+  // two biquads, where t = 0 gives from and t = 1 gives to.
+  void interpolate (const BiquadBase& from, const BiquadBase& to, double t);
+
   // Process a block of samples in the given form
   template <class StateType, typename Sample>
   void process (int numSamples, Sample* dest, StateType& state) const
   {
+    DenormalGuard guard;
+    const BiquadCoefficients <typename StateType::coefficient_t> b (*this);
     while (--numSamples >= 0)
-      *dest++ = state.process (*dest, *this);
+      *dest++ = state.process (*dest, b);
   }
 
 protected:
@@ -108,14 +311,6 @@ protected:
   void setIdentity ();
 
   void applyScale (double scale);
-
-public:
-  double m_a0;
-  double m_a1;
-  double m_a2;
-  double m_b1;
-  double m_b2;
-  double m_b0;
 };
 
 //------------------------------------------------------------------------------
@@ -150,6 +345,7 @@ public:
                        StateType& state,
                        Biquad sectionPrev) const 
   {
+    DenormalGuard guard;
     double t = 1. / numSamples;
     double da1 = (m_a1 - sectionPrev.m_a1) * t;
     double da2 = (m_a2 - sectionPrev.m_a2) * t;
@@ -178,6 +374,7 @@ public:
                        StateType& state,
                        BiquadPoleState zPrev) const 
   {
+    DenormalGuard guard;
     BiquadPoleState z (*this);
     double t = 1. / numSamples;
     complex_t dp0 = (z.poles.first  - zPrev.poles.first) * t;
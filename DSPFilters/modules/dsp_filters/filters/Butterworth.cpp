@@ -105,6 +105,11 @@ void LowPassBase::setup (int order,
                          double sampleRate,
                          double cutoffFrequency)
 {
+  const DesignKey key ("Butterworth Low Pass", order,
+                       cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -112,12 +117,19 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
                           double sampleRate,
                           double cutoffFrequency)
 {
+  const DesignKey key ("Butterworth High Pass", order,
+                       cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -125,6 +137,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -132,6 +146,12 @@ void BandPassBase::setup (int order,
                           double centerFrequency,
                           double widthFrequency)
 {
+  const DesignKey key ("Butterworth Band Pass", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -140,6 +160,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -147,6 +169,12 @@ void BandStopBase::setup (int order,
                           double centerFrequency,
                           double widthFrequency)
 {
+  const DesignKey key ("Butterworth Band Stop", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -155,6 +183,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void LowShelfBase::setup (int order,
@@ -162,6 +192,11 @@ void LowShelfBase::setup (int order,
                          double cutoffFrequency,
                          double gainDb)
 {
+  const DesignKey key ("Butterworth Low Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -169,6 +204,8 @@ void LowShelfBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighShelfBase::setup (int order,
@@ -176,6 +213,11 @@ void HighShelfBase::setup (int order,
                            double cutoffFrequency,
                            double gainDb)
 {
+  const DesignKey key ("Butterworth High Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -183,6 +225,8 @@ void HighShelfBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandShelfBase::setup (int order,
@@ -191,6 +235,12 @@ void BandShelfBase::setup (int order,
                            double widthFrequency,
                            double gainDb)
 {
+  const DesignKey key ("Butterworth Band Shelf", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, gainDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -202,6 +252,8 @@ void BandShelfBase::setup (int order,
   m_digitalProto.setNormal (((centerFrequency/sampleRate) < 0.25) ? doublePi : 0, 1);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
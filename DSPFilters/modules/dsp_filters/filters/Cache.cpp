@@ -0,0 +1,254 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include <map>
+
+namespace Dsp {
+
+bool DesignKey::operator< (const DesignKey& other) const
+{
+  if (order != other.order)
+    return order < other.order;
+
+  for (int i = 0; i < maxValues; ++i)
+    if (value[i] != other.value[i])
+      return value[i] < other.value[i];
+
+  return strcmp (name, other.name) < 0;
+}
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+// Both locks can be initialized statically, so the cache
+// is safe to use from constructors of other static objects.
+#ifdef _WIN32
+SRWLOCK cacheLock = SRWLOCK_INIT;
+
+struct ScopedLock
+{
+  ScopedLock () { AcquireSRWLockExclusive (&cacheLock); }
+  ~ScopedLock () { ReleaseSRWLockExclusive (&cacheLock); }
+};
+#else
+pthread_mutex_t cacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+struct ScopedLock
+{
+  ScopedLock () { pthread_mutex_lock (&cacheLock); }
+  ~ScopedLock () { pthread_mutex_unlock (&cacheLock); }
+};
+#endif
+
+struct Entry
+{
+  int numPoles;
+  double normalW;
+  double normalGain;
+  std::vector<PoleZeroPair> pairs;
+  std::vector<Cascade::Stage> stages;
+  unsigned long lastUsed;
+};
+
+typedef std::map<DesignKey, Entry> EntryMap;
+
+// The key names point at string literals, which outlive the cache
+struct Cache
+{
+  Cache ()
+    : capacity (DesignCache::defaultCapacity)
+    , clock (0)
+  {
+  }
+
+  // Call with the lock held
+  static Cache& get ()
+  {
+    static Cache* cache = 0;
+    if (!cache)
+      cache = new Cache;
+    return *cache;
+  }
+
+  const Entry* find (const DesignKey& key)
+  {
+    EntryMap::iterator iter = entries.find (key);
+    if (iter == entries.end())
+      return 0;
+
+    iter->second.lastUsed = ++clock;
+    return &iter->second;
+  }
+
+  Entry* insert (const DesignKey& key)
+  {
+    if (capacity <= 0)
+      return 0;
+
+    EntryMap::iterator iter = entries.find (key);
+    if (iter == entries.end())
+    {
+      while (int (entries.size()) >= capacity)
+        evict ();
+      iter = entries.insert (std::make_pair (key, Entry ())).first;
+    }
+
+    iter->second.lastUsed = ++clock;
+    return &iter->second;
+  }
+
+  // Discards the least recently used entry
+  void evict ()
+  {
+    EntryMap::iterator oldest = entries.begin();
+    for (EntryMap::iterator iter = entries.begin(); iter != entries.end(); ++iter)
+      if (iter->second.lastUsed < oldest->second.lastUsed)
+        oldest = iter;
+    entries.erase (oldest);
+  }
+
+  int capacity;
+  unsigned long clock;
+  EntryMap entries;
+};
+
+void saveLayout (Entry& entry, const LayoutBase& layout)
+{
+  entry.numPoles = layout.getNumPoles();
+  entry.normalW = layout.getNormalW();
+  entry.normalGain = layout.getNormalGain();
+  entry.pairs.resize ((entry.numPoles + 1) / 2);
+  for (int i = 0; i < int (entry.pairs.size()); ++i)
+    entry.pairs[i] = layout[i];
+}
+
+void loadLayout (const Entry& entry, LayoutBase& layout)
+{
+  layout.setPairs (entry.numPoles, entry.pairs.empty() ? 0 : &entry.pairs[0]);
+  layout.setNormal (entry.normalW, entry.normalGain);
+}
+
+}
+
+//------------------------------------------------------------------------------
+
+void DesignCache::setCapacity (int capacity)
+{
+  ScopedLock lock;
+  Cache& cache = Cache::get ();
+  cache.capacity = capacity;
+  while (int (cache.entries.size()) > std::max (capacity, 0))
+    cache.evict ();
+}
+
+int DesignCache::getCapacity ()
+{
+  ScopedLock lock;
+  return Cache::get().capacity;
+}
+
+void DesignCache::clear ()
+{
+  ScopedLock lock;
+  Cache::get().entries.clear ();
+}
+
+bool DesignCache::findLayout (const DesignKey& key, LayoutBase& layout)
+{
+  ScopedLock lock;
+  const Entry* entry = Cache::get().find (key);
+  if (!entry || entry->numPoles > layout.getMaxPoles())
+    return false;
+
+  loadLayout (*entry, layout);
+  return true;
+}
+
+void DesignCache::storeLayout (const DesignKey& key, const LayoutBase& layout)
+{
+  ScopedLock lock;
+  Entry* entry = Cache::get().insert (key);
+  if (entry)
+    saveLayout (*entry, layout);
+}
+
+bool DesignCache::findCascade (const DesignKey& key,
+                               LayoutBase& layout,
+                               Cascade& cascade)
+{
+  ScopedLock lock;
+  const Entry* entry = Cache::get().find (key);
+  if (!entry)
+    return false;
+
+  // a cascade with less room than the one that was
+  // stored has to make the design for itself
+  if (int (entry->stages.size()) > cascade.m_maxStages ||
+      entry->numPoles > layout.getMaxPoles())
+    return false;
+
+  loadLayout (*entry, layout);
+  cascade.setLayout (layout, entry->stages.empty() ? 0 : &entry->stages[0]);
+  return true;
+}
+
+void DesignCache::storeCascade (const DesignKey& key,
+                                const LayoutBase& layout,
+                                const Cascade& cascade)
+{
+  ScopedLock lock;
+  Entry* entry = Cache::get().insert (key);
+  if (entry)
+  {
+    saveLayout (*entry, layout);
+    entry->stages.assign (cascade.m_stageArray,
+                          cascade.m_stageArray + cascade.m_numStages);
+  }
+}
+
+}
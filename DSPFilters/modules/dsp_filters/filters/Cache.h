@@ -0,0 +1,114 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_CACHE_H
+#define DSPFILTERS_CACHE_H
+
+namespace Dsp {
+
+/*
+ * Process-wide cache of filter designs
+ *
+ * Designing a pole filter means finding the poles and zeros of the
+ * analog prototype, which for some families takes a root finder,
+ * then transforming them to the z-plane and working out the stage
+ * coefficients. Instances often share a handful of distinct designs,
+ * so the results are kept in a cache shared by every thread. It
+ * holds up to a fixed number of the most recently used designs.
+ *
+ */
+
+// Identifies a design. The name tells the family and the prototype
+// or kind of filter apart, the values hold whatever else the design
+// depends on, such as ripple or frequencies divided by the sample rate.
+struct DesignKey
+{
+  enum
+  {
+    maxValues = 4
+  };
+
+  DesignKey (const char* name_,
+             int order_,
+             double value0 = 0,
+             double value1 = 0,
+             double value2 = 0,
+             double value3 = 0)
+    : name (name_)
+    , order (order_)
+  {
+    value[0] = value0;
+    value[1] = value1;
+    value[2] = value2;
+    value[3] = value3;
+  }
+
+  bool operator< (const DesignKey& other) const;
+
+  const char* name;
+  int order;
+  double value[maxValues];
+};
+
+class DesignCache
+{
+public:
+  enum
+  {
+    defaultCapacity = 256
+  };
+
+  // Sets the largest number of designs held, zero turns the cache off
+  static void setCapacity (int capacity);
+  static int getCapacity ();
+
+  static void clear ();
+
+  // An analog prototype. Returns false if it is not in the cache.
+  static bool findLayout (const DesignKey& key, LayoutBase& layout);
+  static void storeLayout (const DesignKey& key, const LayoutBase& layout);
+
+  // A digital layout along with the stages made from it
+  static bool findCascade (const DesignKey& key,
+                           LayoutBase& layout,
+                           Cascade& cascade);
+  static void storeCascade (const DesignKey& key,
+                            const LayoutBase& layout,
+                            const Cascade& cascade);
+};
+
+}
+
+#endif
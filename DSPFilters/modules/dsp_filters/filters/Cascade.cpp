@@ -35,10 +35,22 @@ THE SOFTWARE.
 
 namespace Dsp {
 
+const double Cascade::maxParallelError = 1e-8;
+const double Cascade::maxSingleParallelError = 1e-5;
+
 Cascade::Cascade ()
   : m_numStages (0)
   , m_maxStages (0)
   , m_stageArray (0)
+  , m_singleStageArray (0)
+  , m_sectionArray (0)
+  , m_direct (1)
+  , m_parallelError (0)
+  , m_singleParallelError (0)
+  , m_normalW (0)
+  , m_normalGain (1)
+  , m_processing (sampleMajor)
+  , m_blockSize (0)
 {
 }
 
@@ -47,6 +59,55 @@ void Cascade::setCascadeStorage (const Storage& storage)
   m_numStages = 0;
   m_maxStages = storage.maxStages;
   m_stageArray = storage.stageArray;
+  m_singleStageArray = 0;
+  m_sectionArray = 0;
+}
+
+void Cascade::setSingleStageStorage (SingleStage* singleStageArray)
+{
+  m_singleStageArray = singleStageArray;
+  setSingleStages ();
+}
+
+void Cascade::setSectionStorage (Section* sectionArray)
+{
+  m_sectionArray = sectionArray;
+  if (m_processing == parallel)
+    setParallelSections ();
+}
+
+void Cascade::attachStages (float)
+{
+  if (m_singleStageArray == 0 && m_maxStages > 0)
+  {
+    m_singleStages.resize (m_maxStages);
+    setSingleStageStorage (&m_singleStages[0]);
+  }
+}
+
+void Cascade::setProcessing (Processing processing, int blockSize)
+{
+  assert (blockSize >= 0);
+  m_processing = processing;
+  m_blockSize = blockSize;
+
+  if (m_processing == parallel)
+  {
+    if (m_sectionArray == 0 && m_maxStages > 0)
+    {
+      m_sections.resize (m_maxStages);
+      m_sectionArray = &m_sections[0];
+    }
+
+    setParallelSections ();
+  }
+}
+
+void Cascade::setSingleStages ()
+{
+  if (m_singleStageArray)
+    for (int i = 0; i < m_numStages; ++i)
+      m_singleStageArray[i] = SingleStage (m_stageArray[i]);
 }
 
 complex_t Cascade::response (double normalizedFrequency) const
@@ -95,6 +156,8 @@ void Cascade::applyScale (double scale)
   // to spread this factor between all the stages.
   assert (m_numStages > 0);
   m_stageArray->applyScale (scale);
+  if (m_singleStageArray)
+    m_singleStageArray[0] = SingleStage (m_stageArray[0]);
 }
 
 void Cascade::setLayout (const LayoutBase& proto)
@@ -106,9 +169,227 @@ void Cascade::setLayout (const LayoutBase& proto)
   Biquad* stage = m_stageArray;
   for (int i = 0; i < m_numStages; ++i, ++stage)
     stage->setPoleZeroPair (proto[i]);
+  setSingleStages ();
   
-  applyScale (proto.getNormalGain() /
-              std::abs (response (proto.getNormalW() / (2 * doublePi))));
+  m_normalW = proto.getNormalW();
+  m_normalGain = proto.getNormalGain();
+  applyScale (m_normalGain /
+              std::abs (response (m_normalW / (2 * doublePi))));
+
+  if (m_processing == parallel)
+    setParallelSections ();
+}
+
+void Cascade::interpolate (const Cascade& from, const Cascade& to, double t)
+{
+  m_numStages = to.m_numStages;
+  assert (m_numStages <= m_maxStages);
+
+  if (from.m_numStages == to.m_numStages)
+  {
+    for (int i = 0; i < m_numStages; ++i)
+      m_stageArray[i].interpolate (from.m_stageArray[i], to.m_stageArray[i], t);
+    setSingleStages ();
+
+    // The normalization is lumped into the first stage, and does
+    // not follow a straight line when the denominators do. Only the
+    // squared magnitude is needed, which avoids complex products.
+    m_normalW = from.m_normalW + (to.m_normalW - from.m_normalW) * t;
+    m_normalGain = from.m_normalGain + (to.m_normalGain - from.m_normalGain) * t;
+    if (m_numStages > 0)
+    {
+      const complex_t w = std::polar (1., -m_normalW);
+      const complex_t w2 = w * w;
+      double norm = 1;
+      for (int i = 0; i < m_numStages; ++i)
+      {
+        const Stage& s = m_stageArray[i];
+        norm *= std::norm (1. + s.m_a1 * w + s.m_a2 * w2) /
+                std::norm (s.m_b0 + s.m_b1 * w + s.m_b2 * w2);
+      }
+      applyScale (m_normalGain * std::sqrt (norm));
+    }
+  }
+  else
+  {
+    for (int i = 0; i < m_numStages; ++i)
+      m_stageArray[i] = to.m_stageArray[i];
+    setSingleStages ();
+
+    m_normalW = to.m_normalW;
+    m_normalGain = to.m_normalGain;
+  }
+
+  if (m_processing == parallel)
+    setParallelSections ();
+}
+
+void Cascade::setLayout (const LayoutBase& proto, const Stage* stages)
+{
+  m_numStages = (proto.getNumPoles() + 1) / 2;
+  assert (m_numStages <= m_maxStages);
+
+  for (int i = 0; i < m_numStages; ++i)
+    m_stageArray[i] = stages[i];
+  setSingleStages ();
+
+  m_normalW = proto.getNormalW();
+  m_normalGain = proto.getNormalGain();
+
+  if (m_processing == parallel)
+    setParallelSections ();
+}
+
+// Response of a single stage, as a function of w = 1/z
+static complex_t stageResponse (const BiquadBase& s, complex_t w)
+{
+  return (s.m_b0 + (s.m_b1 + s.m_b2 * w) * w) /
+         (1. + (s.m_a1 + s.m_a2 * w) * w);
+}
+
+// Residue of the cascade at a pole of the given stage,
+// whose second pole is otherPole (zero if it only has one)
+complex_t Cascade::residue (int stage, complex_t pole, complex_t otherPole) const
+{
+  const complex_t w = 1. / pole;
+  complex_t r = 1;
+  for (int i = 0; i < m_numStages; ++i)
+    if (i != stage)
+      r *= stageResponse (m_stageArray[i], w);
+
+  const Stage& s = m_stageArray[stage];
+  r *= s.m_b0 + (s.m_b1 + s.m_b2 * w) * w;
+  r /= 1. - otherPole * w;
+
+  return r;
+}
+
+// Absolute sum of the impulse response r p^n of one term
+static double termBound (complex_t r, complex_t p)
+{
+  const double radius = std::abs (p);
+  if (radius < 1)
+    return std::abs (r) / (1 - radius);
+  else
+    return std::numeric_limits<double>::infinity();
+}
+
+// Partial fraction expansion of the cascade,
+//
+//  H(z) = direct + sum of r[i] / (1 - p[i] z^-1)
+//
+// The two terms from the poles of each stage, which are a conjugate
+// pair or both real, combine into one section with real coefficients.
+//
+// Though exact in theory, the expansion can be poorly conditioned,
+// with sections far louder than their sum. Two estimates of the error
+// are kept, relative to the passband gain. The sections themselves are
+// checked against the cascade, which catches residues spoilt by poles
+// that crowd together. To that comes the rounding while processing,
+// amplified by the ratio of the sections' absolute impulse response
+// sums to the passband gain. Poles which coincide, or sit at the
+// origin, have no expansion of this form and give an infinite error.
+void Cascade::setParallelSections ()
+{
+  m_direct = 1;
+  double condition = 0;
+
+  for (int i = 0; i < m_numStages; ++i)
+  {
+    const Stage& s = m_stageArray[i];
+    Section& section = m_sectionArray[i];
+
+    section.m_a0 = 1;
+    section.m_a1 = s.m_a1;
+    section.m_a2 = s.m_a2;
+    section.m_b0 = 0;
+    section.m_b1 = 0;
+    section.m_b2 = 0;
+
+    if (s.m_a2 != 0)
+    {
+      const complex_t d = std::sqrt (complex_t (s.m_a1 * s.m_a1 - 4 * s.m_a2));
+      const complex_t p1 = (-s.m_a1 + d) * 0.5;
+      const complex_t p2 = (-s.m_a1 - d) * 0.5;
+
+      if (p1 != p2)
+      {
+        const complex_t r1 = residue (i, p1, p2);
+        const complex_t r2 = residue (i, p2, p1);
+
+        section.m_b0 = (r1 + r2).real();
+        section.m_b1 = -(r1 * p2 + r2 * p1).real();
+
+        m_direct *= s.m_b2 / s.m_a2;
+        condition += termBound (r1, p1) + termBound (r2, p2);
+      }
+      else
+      {
+        condition = std::numeric_limits<double>::infinity();
+      }
+    }
+    else if (s.m_a1 != 0 && s.m_b2 == 0)
+    {
+      const complex_t r = residue (i, -s.m_a1, 0);
+
+      section.m_b0 = r.real();
+
+      m_direct *= s.m_b1 / s.m_a1;
+      condition += termBound (r, -s.m_a1);
+    }
+    else
+    {
+      condition = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  // NaN, from residues at poles which coincide across stages, fails
+  // the comparison in usesParallel() just like infinity does.
+  condition /= std::abs (m_normalGain);
+  m_parallelError = expansionError <double> () +
+                    condition * DBL_EPSILON;
+  m_singleParallelError = expansionError <float> () +
+                          condition * FLT_EPSILON;
+}
+
+// Largest difference between the response of the sections, rounded
+// to the precision of the state which reads them, and that of the
+// cascade, relative to the passband gain. It is measured at DC,
+// Nyquist, the normalization frequency, and the angle of the poles
+// of each stage, where the sections peak and cancel the most.
+template <typename Coefficient>
+double Cascade::expansionError () const
+{
+  double error = std::max (expansionError <Coefficient> (0),
+                           expansionError <Coefficient> (doublePi));
+  error = std::max (error, expansionError <Coefficient> (m_normalW));
+
+  for (int i = 0; i < m_numStages; ++i)
+  {
+    // argument of 2 p1, which is 0 or pi for real poles
+    const Stage& s = m_stageArray[i];
+    const double w = std::arg (complex_t (-s.m_a1, std::sqrt (
+      std::max (0., 4 * s.m_a2 - s.m_a1 * s.m_a1))));
+    error = std::max (error, expansionError <Coefficient> (w));
+  }
+
+  return error / std::abs (m_normalGain);
+}
+
+template <typename Coefficient>
+double Cascade::expansionError (double w) const
+{
+  const complex_t z1 = std::polar (1., -w);
+  complex_t h = m_direct;
+  for (int i = 0; i < m_numStages; ++i)
+  {
+    const BiquadCoefficients <double> section (
+      BiquadCoefficients <Coefficient> (m_sectionArray[i]));
+    h += (section.m_b0 + section.m_b1 * z1) /
+         (1. + (section.m_a1 + section.m_a2 * z1) * z1);
+  }
+
+  return std::abs (h - response (w / (2 * doublePi)));
 }
 
 }
@@ -43,6 +43,110 @@ namespace Dsp {
  *
  */
 
+// Runs the independent sections of a parallel form for one channel,
+// Width sections at a time in the lanes of a vector, then narrower
+// groups for what is left, and adds their output to out. Returns the
+// number of sections processed, the caller is responsible for the
+// remainder.
+template <int Width>
+struct SectionGroups
+{
+  template <class StateType, class Section>
+  static int process (int numSamples,
+                      const typename StateType::value_t* in,
+                      typename StateType::value_t* out,
+                      int numSections,
+                      StateType* states,
+                      const Section* sections)
+  {
+    typedef typename StateType::value_t value_t;
+    typedef LaneVector <Width, value_t> vector_t;
+    typedef typename StateType::template Lanes <vector_t> lanes_t;
+
+    int j = 0;
+
+    if (numSections >= Width)
+    {
+      const vector_t zero (0);
+      vector_t acc [laneBlockSize];
+      for (int i = 0; i < numSamples; ++i)
+        acc[i] = zero;
+
+      for (; j + Width <= numSections; j += Width)
+      {
+        lanes_t lanes;
+        for (int l = 0; l < Width; ++l)
+        {
+          lanes.setCoefficients (l, sections[j + l]);
+          lanes.load (l, states[j + l]);
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+          acc[i] = acc[i] + lanes.process1 (vector_t (in[i]), zero);
+
+        for (int l = 0; l < Width; ++l)
+          lanes.store (l, states[j + l]);
+      }
+
+      for (int i = 0; i < numSamples; ++i)
+        out[i] += acc[i].sum ();
+    }
+
+    return j + SectionGroups <Width / 2>::process (
+      numSamples, in, out, numSections - j, states + j, sections + j);
+  }
+};
+
+// Single sections are left to the caller
+template <>
+struct SectionGroups <1>
+{
+  template <class StateType, class Section>
+  static int process (int,
+                      const typename StateType::value_t*,
+                      typename StateType::value_t*,
+                      int,
+                      StateType*,
+                      const Section*)
+  {
+    return 0;
+  }
+};
+
+// Realizations without Lanes process every section on their own
+template <bool Supported>
+struct SectionLanes
+{
+  template <class StateType, class Section>
+  static int process (int,
+                      const typename StateType::value_t*,
+                      typename StateType::value_t*,
+                      int,
+                      StateType*,
+                      const Section*)
+  {
+    return 0;
+  }
+};
+
+template <>
+struct SectionLanes <true>
+{
+  template <class StateType, class Section>
+  static int process (int numSamples,
+                      const typename StateType::value_t* in,
+                      typename StateType::value_t* out,
+                      int numSections,
+                      StateType* states,
+                      const Section* sections)
+  {
+    return SectionGroups <LaneWidth <typename StateType::value_t>::max>::process (
+      numSamples, in, out, numSections, states, sections);
+  }
+};
+
+//------------------------------------------------------------------------------
+
 // Factored implementation to reduce template instantiations
 class Cascade
 {
@@ -51,14 +155,124 @@ public:
   class StateBase : private DenormalPrevention
   {
   public:
+    typedef typename StateType::value_t value_t;
+    typedef typename StateType::coefficient_t coefficient_t;
+
+    enum
+    {
+      supportsLanes = LaneTraits <StateType>::supported
+    };
+
+    // Lets the cascade keep the coefficients this state reads
+    static void attach (Cascade& c)
+    {
+      c.attachStages (coefficient_t ());
+    }
+
+    // Float state rounds the double stages itself unless the cascade
+    // keeps single precision copies of them; see attachStages().
     template <typename Sample>
     inline Sample process (const Sample in, const Cascade& c)
     {
-      double out = in;
+      if (c.hasStages (coefficient_t ()))
+        return process (in, c.m_numStages, c.getStages (coefficient_t ()));
+      else
+        return process (in, c.m_numStages, c.getStages (double ()));
+    }
+
+    // Process a group of channels which share the cascade, one channel
+    // in each lane of Vector. Each stage runs over a block of samples
+    // before the next, so its coefficients and state stay in registers,
+    // already in the precision of the state.
+    template <class Vector, class DesignState, class Channels>
+    static void processLanes (int numSamples,
+                              const Channels& dest,
+                              DesignState* states,
+                              const Cascade& c)
+    {
+      if (c.usesParallel (coefficient_t ()))
+        processParallelLanes <Vector> (numSamples, dest, states,
+                                       c.m_numStages,
+                                       c.m_sectionArray,
+                                       value_t (c.m_direct));
+      else
+        processLanes <Vector> (numSamples, dest, states,
+                               c.m_numStages, c.m_stageArray);
+    }
+
+    // Process a block in parallel form. Every section filters the
+    // input independently and their outputs are summed. The anti-
+    // denormal offset goes into the shared input, so the sections
+    // and the direct term see the same signal.
+    template <typename Sample>
+    void processParallel (int numSamples, Sample* dest, const Cascade& c)
+    {
+      processParallel (numSamples, dest,
+                       c.m_numStages, c.m_sectionArray,
+                       value_t (c.m_direct));
+    }
+
+    // Process a block one stage at a time. Each stage filters a
+    // tile of samples before the next stage runs over it.
+    template <typename Sample>
+    void processStages (int numSamples, Sample* dest, const Cascade& c)
+    {
+      if (numSamples <= 0)
+        return;
+
+      value_t vsa = value_t (ac());
+      if (!(numSamples & 1))
+        ac();
+
+      // intermediate results between stages keep the state's precision
+      const int blockSize = (c.m_blockSize > 0 &&
+                             c.m_blockSize < stageBlockSize) ?
+                             c.m_blockSize : int (stageBlockSize);
+      value_t buf [stageBlockSize];
+
+      for (int offset = 0; offset < numSamples; offset += blockSize)
+      {
+        const int n = std::min (numSamples - offset, blockSize);
+        for (int i = 0; i < n; ++i)
+          buf[i] = static_cast<value_t> (dest[offset + i]);
+        processTile (n, buf, c.m_numStages, c.m_stageArray, vsa);
+        for (int i = 0; i < n; ++i)
+          dest[offset + i] = static_cast<Sample> (buf[i]);
+      }
+    }
+
+    // Samples already in the state's precision are filtered in place
+    void processStages (int numSamples, value_t* dest, const Cascade& c)
+    {
+      if (numSamples <= 0)
+        return;
+
+      value_t vsa = value_t (ac());
+      if (!(numSamples & 1))
+        ac();
+
+      const int blockSize = c.m_blockSize > 0 ? c.m_blockSize : numSamples;
+
+      for (int offset = 0; offset < numSamples; offset += blockSize)
+        processTile (std::min (numSamples - offset, blockSize),
+                     dest + offset,
+                     c.m_numStages, c.m_stageArray, vsa);
+    }
+
+  protected:
+    StateBase (StateType* stateArray)
+      : m_stateArray (stateArray)
+    {
+    }
+
+  private:
+    template <typename Sample, class Stage>
+    inline Sample process (const Sample in, int numStages, const Stage* stage)
+    {
+      value_t out = static_cast<value_t> (in);
       StateType* state = m_stateArray;
-      Biquad const* stage = c.m_stageArray;
-      const double vsa = ac();
-      int i = c.m_numStages - 1;
+      const value_t vsa = value_t (ac());
+      int i = numStages - 1;
         out = (state++)->process1 (out, *stage++, vsa);
       for (; --i >= 0;)
         out = (state++)->process1 (out, *stage++, 0);
@@ -67,20 +281,238 @@ public:
       return static_cast<Sample> (out);
     }
 
-  protected:
-    StateBase (StateType* stateArray)
-      : m_stateArray (stateArray)
+    template <class Vector, class DesignState, class Channels, class Stage>
+    static void processLanes (int numSamples,
+                              const Channels& dest,
+                              DesignState* states,
+                              int numStages,
+                              const Stage* stages)
     {
+      typedef typename StateType::template Lanes <Vector> lanes_t;
+
+      if (numSamples <= 0)
+        return;
+
+      // the anti-denormal offset alternates with each sample
+      Vector vsa;
+      for (int l = 0; l < Vector::lanes; ++l)
+        vsa.set (l, value_t (static_cast<StateBase&>(states[l]).ac ()));
+      if (!(numSamples & 1))
+        for (int l = 0; l < Vector::lanes; ++l)
+          static_cast<StateBase&>(states[l]).ac ();
+
+      const Vector zero (0);
+      Vector buf [laneBlockSize];
+
+      for (int offset = 0; offset < numSamples; offset += laneBlockSize)
+      {
+        const int n = std::min (numSamples - offset, int (laneBlockSize));
+
+        for (int i = 0; i < n; ++i)
+          buf[i].load (dest, offset + i);
+
+        const Stage* stage = stages;
+        for (int j = 0; j < numStages; ++j, ++stage)
+        {
+          lanes_t lanes (*stage);
+          for (int l = 0; l < Vector::lanes; ++l)
+            lanes.load (l, static_cast<StateBase&>(states[l]).m_stateArray[j]);
+
+          if (j == 0)
+          {
+            for (int i = 0; i < n; ++i)
+            {
+              buf[i] = lanes.process1 (buf[i], vsa);
+              vsa = -vsa;
+            }
+          }
+          else
+          {
+            for (int i = 0; i < n; ++i)
+              buf[i] = lanes.process1 (buf[i], zero);
+          }
+
+          for (int l = 0; l < Vector::lanes; ++l)
+            lanes.store (l, static_cast<StateBase&>(states[l]).m_stateArray[j]);
+        }
+
+        for (int i = 0; i < n; ++i)
+          buf[i].store (dest, offset + i);
+      }
+    }
+
+    template <class Vector, class DesignState, class Channels, class Section>
+    static void processParallelLanes (int numSamples,
+                                      const Channels& dest,
+                                      DesignState* states,
+                                      int numSections,
+                                      const Section* sections,
+                                      value_t direct)
+    {
+      typedef typename StateType::template Lanes <Vector> lanes_t;
+
+      if (numSamples <= 0)
+        return;
+
+      Vector vsa;
+      for (int l = 0; l < Vector::lanes; ++l)
+        vsa.set (l, value_t (static_cast<StateBase&>(states[l]).ac ()));
+      if (!(numSamples & 1))
+        for (int l = 0; l < Vector::lanes; ++l)
+          static_cast<StateBase&>(states[l]).ac ();
+
+      const Vector d (direct);
+      const Vector zero (0);
+      Vector in [laneBlockSize];
+      Vector out [laneBlockSize];
+
+      for (int offset = 0; offset < numSamples; offset += laneBlockSize)
+      {
+        const int n = std::min (numSamples - offset, int (laneBlockSize));
+
+        for (int i = 0; i < n; ++i)
+        {
+          in[i].load (dest, offset + i);
+          in[i] = add_denormal_offset (in[i], vsa);
+          out[i] = d * in[i];
+          vsa = -vsa;
+        }
+
+        const Section* section = sections;
+        for (int j = 0; j < numSections; ++j, ++section)
+        {
+          lanes_t lanes (*section);
+          for (int l = 0; l < Vector::lanes; ++l)
+            lanes.load (l, static_cast<StateBase&>(states[l]).m_stateArray[j]);
+
+          for (int i = 0; i < n; ++i)
+            out[i] = out[i] + lanes.process1 (in[i], zero);
+
+          for (int l = 0; l < Vector::lanes; ++l)
+            lanes.store (l, static_cast<StateBase&>(states[l]).m_stateArray[j]);
+        }
+
+        for (int i = 0; i < n; ++i)
+          out[i].store (dest, offset + i);
+      }
+    }
+
+    template <typename Sample, class Section>
+    void processParallel (int numSamples,
+                          Sample* dest,
+                          int numSections,
+                          const Section* sections,
+                          value_t direct)
+    {
+      if (numSamples <= 0)
+        return;
+
+      value_t vsa = value_t (ac());
+      if (!(numSamples & 1))
+        ac();
+
+      value_t in [laneBlockSize];
+      value_t out [laneBlockSize];
+
+      for (int offset = 0; offset < numSamples; offset += laneBlockSize)
+      {
+        const int n = std::min (numSamples - offset, int (laneBlockSize));
+
+        for (int i = 0; i < n; ++i)
+        {
+          in[i] = add_denormal_offset (
+            static_cast<value_t> (dest[offset + i]), vsa);
+          out[i] = direct * in[i];
+          vsa = -vsa;
+        }
+
+        // sections are independent, so several run side by side
+        int j = SectionLanes <supportsLanes>::process (
+          n, in, out, numSections, m_stateArray, sections);
+
+        for (; j < numSections; ++j)
+        {
+          const BiquadCoefficients <coefficient_t> b (sections[j]);
+          StateType state = m_stateArray[j];
+
+          for (int i = 0; i < n; ++i)
+            out[i] += state.process1 (in[i], b, 0);
+
+          m_stateArray[j] = state;
+        }
+
+        for (int i = 0; i < n; ++i)
+          dest[offset + i] = static_cast<Sample> (out[i]);
+      }
+    }
+
+    // Working copies of the coefficients and state let the
+    // compiler keep them in registers for the whole tile.
+    template <class Stage>
+    void processTile (int n, value_t* buf,
+                      int numStages, const Stage* stage,
+                      value_t& vsa)
+    {
+      for (int j = 0; j < numStages; ++j, ++stage)
+      {
+        const BiquadCoefficients <coefficient_t> b (*stage);
+        StateType state = m_stateArray[j];
+
+        if (j == 0)
+        {
+          value_t v = vsa;
+          for (int i = 0; i < n; ++i)
+          {
+            buf[i] = state.process1 (buf[i], b, v);
+            v = -v;
+          }
+          vsa = v;
+        }
+        else
+        {
+          for (int i = 0; i < n; ++i)
+            buf[i] = state.process1 (buf[i], b, 0);
+        }
+
+        m_stateArray[j] = state;
+      }
     }
 
   protected:
     StateType* m_stateArray;
   };
 
+  // Order in which process() visits the samples and stages
+  enum Processing
+  {
+    sampleMajor,  // each sample runs through every stage (default)
+    stageMajor,   // each stage runs over a tile of samples
+    parallel      // stages are expanded into a sum of independent sections
+  };
+
+  enum
+  {
+    // Largest tile used when converting samples to double precision
+    stageBlockSize = 1024
+  };
+
+  // Largest estimated error of the parallel form, relative to the
+  // passband gain, before process() falls back to the cascade. For
+  // double state it is below the last bit of 24 bit audio, for float
+  // state about what the cascade itself loses at high orders.
+  static const double maxParallelError;
+  static const double maxSingleParallelError;
+
   struct Stage : Biquad
   {
   };
 
+  // Single precision copy of a stage, for processing float state
+  typedef BiquadCoefficients <float> SingleStage;
+
+  // Section of the parallel form, b2 is always zero
+  typedef BiquadCoefficients <double> Section;
+
   struct Storage
   {
     Storage (int maxStages_, Stage* stageArray_)
@@ -98,7 +530,55 @@ public:
     return m_numStages;
   }
 
-  const Stage& operator[] (int index)
+  // Keeps single precision copies of the stages, for state whose
+  // coefficients are float. Processing sample by sample, such state
+  // otherwise rounds every stage again for every sample; the output is
+  // the same either way. The wrappers call this for their StateType.
+  // It allocates, so call it before processing starts.
+  void attachStages (float);
+
+  void attachStages (double)
+  {
+  }
+
+  // Selects the processing strategy. For stageMajor, blockSize is the
+  // number of samples in a tile; choose it so that a tile of doubles
+  // fits in the L1 cache. Zero filters the whole block one stage at a
+  // time (blocks of float samples are still tiled by stageBlockSize).
+  // The output is the same either way, only the speed differs.
+  //
+  // The parallel form is exact in theory, but its sections can be
+  // far louder than their sum. Its error is estimated whenever the
+  // layout changes, and when it exceeds maxParallelError (or the
+  // poles coincide) process() runs sampleMajor instead; see
+  // usesParallel(). A Butterworth low pass at 1 kHz and 44.1 kHz
+  // keeps the parallel form with double state up to order 24 or so,
+  // lower cutoffs give up sooner, and with float state only the
+  // lowest orders qualify. Its state means something different, so
+  // reset() the channels when switching to or from it, including
+  // when a new layout changes what usesParallel() returns. The
+  // sections are allocated the first time parallel is selected.
+  void setProcessing (Processing processing, int blockSize = 0);
+
+  Processing getProcessing () const
+  {
+    return m_processing;
+  }
+
+  // True when process() really uses the parallel form, for state
+  // whose coefficients have the precision of the argument
+  bool usesParallel (double) const
+  {
+    return m_processing == parallel && m_parallelError <= maxParallelError;
+  }
+
+  bool usesParallel (float) const
+  {
+    return m_processing == parallel &&
+           m_singleParallelError <= maxSingleParallelError;
+  }
+
+  const Stage& operator[] (int index) const
   {
     assert (index >= 0 && index <= m_numStages);
     return m_stageArray[index];
@@ -110,12 +590,42 @@ public:
 
   std::vector<PoleZeroPair> getPoleZeros () const;
 
+  // Sets each stage to a point on the straight line between the
+  // corresponding stages of two cascades, where t = 0 gives from
+  // and t = 1 gives to. Since the region of stable denominators is
+  // convex, the result is stable when both ends are. The gain is
+  // normalized again, at a frequency and to a value interpolated
+  // between those of the two layouts. Cascades with a different
+  // number of stages cannot be paired, so this takes the stages of
+  // to instead.
+  void interpolate (const Cascade& from, const Cascade& to, double t);
+
   // Process a block of samples in the given form
   template <class StateType, typename Sample>
   void process (int numSamples, Sample* dest, StateType& state) const
   {
-    while (--numSamples >= 0)
-      *dest++ = state.process (*dest, *this);
+    DenormalGuard guard;
+
+    Processing processing = m_processing;
+    if (processing == parallel &&
+        !usesParallel (typename StateType::coefficient_t ()))
+      processing = sampleMajor;
+
+    switch (processing)
+    {
+    case stageMajor:
+      state.processStages (numSamples, dest, *this);
+      break;
+
+    case parallel:
+      state.processParallel (numSamples, dest, *this);
+      break;
+
+    default:
+      while (--numSamples >= 0)
+        *dest++ = state.process (*dest, *this);
+      break;
+    }
   }
 
 protected:
@@ -123,13 +633,70 @@ protected:
 
   void setCascadeStorage (const Storage& storage);
 
+  // Storage for maxStages single precision stages or sections, used
+  // in place of what attachStages() and setProcessing() allocate
+  void setSingleStageStorage (SingleStage* singleStageArray);
+  void setSectionStorage (Section* sectionArray);
+
   void applyScale (double scale);
   void setLayout (const LayoutBase& proto);
 
+  // Uses stages which were made from the layout before
+  void setLayout (const LayoutBase& proto, const Stage* stages);
+
 private:
+  friend class DesignCache;
+  friend class FrequencyResponse;
+
+  // True when the stages are kept in the given precision
+  bool hasStages (double) const
+  {
+    return true;
+  }
+
+  bool hasStages (float) const
+  {
+    return m_singleStageArray != 0;
+  }
+
+  // Coefficients of each stage in the given precision
+  const Stage* getStages (double) const
+  {
+    return m_stageArray;
+  }
+
+  const SingleStage* getStages (float) const
+  {
+    return m_singleStageArray;
+  }
+
+  void setSingleStages ();
+
+  complex_t residue (int stage, complex_t pole, complex_t otherPole) const;
+  void setParallelSections ();
+
+  // Error of the sections once rounded to the given precision
+  template <typename Coefficient>
+  double expansionError () const;
+
+  template <typename Coefficient>
+  double expansionError (double w) const;
+
+
   int m_numStages;
   int m_maxStages;
   Stage* m_stageArray;
+  SingleStage* m_singleStageArray;
+  Section* m_sectionArray;
+  std::vector<SingleStage> m_singleStages;
+  std::vector<Section> m_sections;
+  double m_direct;
+  double m_parallelError;
+  double m_singleParallelError;
+  double m_normalW;
+  double m_normalGain;
+  Processing m_processing;
+  int m_blockSize;
 };
 
 //------------------------------------------------------------------------------
@@ -145,10 +712,23 @@ public:
   public:
     State() : Cascade::StateBase <StateType> (m_states)
     {
-      Cascade::StateBase <StateType>::m_stateArray = m_states;
       reset ();
     }
 
+    // A copy keeps pointing at its own states
+    State (const State& other)
+      : Cascade::StateBase <StateType> (other)
+    {
+      copyStates (other);
+    }
+
+    State& operator= (const State& other)
+    {
+      Cascade::StateBase <StateType>::operator= (other);
+      copyStates (other);
+      return *this;
+    }
+
     void reset ()
     {
       StateType* state = m_states;
@@ -156,6 +736,14 @@ public:
         state->reset();
     }
 
+  private:
+    void copyStates (const State& other)
+    {
+      Cascade::StateBase <StateType>::m_stateArray = m_states;
+      for (int i = 0; i < MaxStages; ++i)
+        m_states[i] = other.m_states[i];
+    }
+
   private:
     StateType m_states[MaxStages];
   };
@@ -170,6 +758,42 @@ private:
   Cascade::Stage m_stages[MaxStages];
 };
 
+//------------------------------------------------------------------------------
+
+// State with one element for each stage of a cascade whose storage
+// is sized at run time. The elements live elsewhere, usually in an
+// Arena, and are not copied along with the state.
+template <class StateType>
+class SizedState : public Cascade::StateBase <StateType>
+{
+public:
+  SizedState (StateType* stateArray, int numStages)
+    : Cascade::StateBase <StateType> (stateArray)
+    , m_numStages (numStages)
+  {
+    reset ();
+  }
+
+  void reset ()
+  {
+    StateType* state = Cascade::StateBase <StateType>::m_stateArray;
+    for (int i = m_numStages; --i >= 0; ++state)
+      state->reset();
+  }
+
+  int getNumStages () const
+  {
+    return m_numStages;
+  }
+
+private:
+  SizedState (const SizedState&);
+  SizedState& operator= (const SizedState&);
+
+private:
+  int m_numStages;
+};
+
 }
 
 #endif
@@ -160,6 +160,11 @@ void LowPassBase::setup (int order,
                          double cutoffFrequency,
                          double rippleDb)
 {
+  const DesignKey key ("Chebyshev I Low Pass", order,
+                       cutoffFrequency / sampleRate, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -167,6 +172,8 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
@@ -174,6 +181,11 @@ void HighPassBase::setup (int order,
                           double cutoffFrequency,
                           double rippleDb)
 {
+  const DesignKey key ("Chebyshev I High Pass", order,
+                       cutoffFrequency / sampleRate, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -181,6 +193,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -189,6 +203,12 @@ void BandPassBase::setup (int order,
                           double widthFrequency,
                           double rippleDb)
 {
+  const DesignKey key ("Chebyshev I Band Pass", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -197,6 +217,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -205,6 +227,12 @@ void BandStopBase::setup (int order,
                           double widthFrequency,
                           double rippleDb)
 {
+  const DesignKey key ("Chebyshev I Band Stop", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -213,6 +241,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void LowShelfBase::setup (int order,
@@ -221,6 +251,11 @@ void LowShelfBase::setup (int order,
                           double gainDb,
                           double rippleDb)
 {
+  const DesignKey key ("Chebyshev I Low Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, rippleDb);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -228,6 +263,8 @@ void LowShelfBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighShelfBase::setup (int order,
@@ -236,6 +273,11 @@ void HighShelfBase::setup (int order,
                            double gainDb,
                            double rippleDb)
 {
+  const DesignKey key ("Chebyshev I High Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, rippleDb);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -243,6 +285,8 @@ void HighShelfBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandShelfBase::setup (int order,
@@ -252,6 +296,12 @@ void BandShelfBase::setup (int order,
                            double gainDb,
                            double rippleDb)
 {
+  const DesignKey key ("Chebyshev I Band Shelf", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, gainDb, rippleDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, rippleDb);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -262,6 +312,8 @@ void BandShelfBase::setup (int order,
   m_digitalProto.setNormal (((centerFrequency/sampleRate) < 0.25) ? doublePi : 0, 1);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
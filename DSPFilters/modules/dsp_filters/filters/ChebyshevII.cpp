@@ -159,6 +159,11 @@ void LowPassBase::setup (int order,
                          double cutoffFrequency,
                          double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II Low Pass", order,
+                       cutoffFrequency / sampleRate, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, stopBandDb);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -166,6 +171,8 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
@@ -173,6 +180,11 @@ void HighPassBase::setup (int order,
                           double cutoffFrequency,
                           double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II High Pass", order,
+                       cutoffFrequency / sampleRate, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, stopBandDb);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -180,6 +192,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -188,6 +202,12 @@ void BandPassBase::setup (int order,
                           double widthFrequency,
                           double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II Band Pass", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, stopBandDb);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -196,6 +216,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -204,6 +226,12 @@ void BandStopBase::setup (int order,
                           double widthFrequency,
                           double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II Band Stop", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, stopBandDb);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -212,6 +240,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void LowShelfBase::setup (int order,
@@ -220,6 +250,11 @@ void LowShelfBase::setup (int order,
                           double gainDb,
                           double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II Low Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, stopBandDb);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -227,6 +262,8 @@ void LowShelfBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighShelfBase::setup (int order,
@@ -235,6 +272,11 @@ void HighShelfBase::setup (int order,
                            double gainDb,
                            double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II High Shelf", order,
+                       cutoffFrequency / sampleRate, gainDb, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, stopBandDb);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -242,6 +284,8 @@ void HighShelfBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandShelfBase::setup (int order,
@@ -251,6 +295,12 @@ void BandShelfBase::setup (int order,
                            double gainDb,
                            double stopBandDb)
 {
+  const DesignKey key ("Chebyshev II Band Shelf", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, gainDb, stopBandDb);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, gainDb, stopBandDb);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -261,6 +311,8 @@ void BandShelfBase::setup (int order,
   m_digitalProto.setNormal (((centerFrequency/sampleRate) < 0.25) ? doublePi : 0, 1);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
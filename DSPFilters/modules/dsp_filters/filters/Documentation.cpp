@@ -162,6 +162,22 @@ class Filter
   frequency in the range (0..nyquist = 0.5]. From the complex number the
   magnitude and phase can be calculated.
 
+  The overloads of response() taking a count evaluate a whole array of
+  frequencies at once, or evenly spaced ones given the first frequency
+  and the spacing. They return either the complex response or one of the
+  measures of FrequencyResponse: magnitude, magnitude squared, gain in
+  decibels or phase. The stages are evaluated several frequencies at a
+  time, the magnitudes use only real arithmetic, and the gain in decibels
+  is accumulated as a sum of logarithms so that the deep stopband of a
+  high order filter does not underflow. A FrequencyResponse can also be
+  made directly from a Cascade or a Biquad and kept for repeated use.
+
+  This is also the path for dense analyzers with thousands of bins. On
+  an evenly spaced grid the points on the unit circle come from rotating
+  earlier ones, so the cost is a few vector operations per stage and
+  bin, which is less than an FFT of the multiplied out polynomials costs
+  for cascades of the orders in this library.
+
   Filter::getNumChannels()
   Filter::reset()
   Filter::process()
@@ -170,6 +186,75 @@ class Filter
   filter was not created with channel state (i.e. Channels==0 in the derived
   class template) then they will throw an exception.
 
+  Filter::processInterleaved()
+
+  Applies the filter in place to channels stored interleaved, frame by
+  frame, as they come from most audio devices and files, without separating
+  them first. The number of channels must match getNumChannels(), in
+  release builds as well, or std::logic_error is thrown. Groups of
+  channels are loaded into the lanes of a vector straight from each
+  frame. SimpleFilter provides the same function.
+
+  To keep decaying tails out of the denormal range, the first stage adds
+  a very small alternating offset to every sample. Defining the macro
+  DSPFILTERS_FLUSH_DENORMALS before including the library instead runs
+  every call to process() under a ScopedFlushDenormals, which puts the
+  processor in flush to zero and denormals are zero mode and restores it
+  afterwards, and the offset compiles out. Results are then exact down to
+  the smallest normal number, and every stage is covered rather than only
+  the first. The guard is only effective with SSE2; on other hardware
+  leave the macro undefined. An application can also hold its own
+  ScopedFlushDenormals around a whole audio callback, which makes the
+  guards inside the library free.
+
+  Filter::setWorkerPool()
+
+  With hundreds of channels a single core becomes the limit. Create one
+  WorkerPool per application, with a worker for each core beyond the
+  calling thread, and hand it to every filter that should use it. Planar
+  process() calls then split the channels into contiguous runs of whole
+  lane groups and run them in parallel, the calling thread taking part
+  and returning when all runs are done. Results are identical to the
+  single threaded ones. A pool with no other work costs nothing but the
+  sleeping threads, and filters with too few channels to fill two runs
+  never touch it. With dynamicChannels the state of each channel is padded
+  to a cache line so that runs never share one. Workers can be pinned to
+  cores with WorkerPool::pinWorker(), on Windows and Linux only.
+  processInterleaved() always stays on the calling thread, since channels
+  of the same frame share cache lines. The pool is not owned by the
+  filter and must outlive it; passing 0 goes back to single threaded
+  processing. A filter made with Channels==0 accepts a pool and ignores
+  it, since it has no channels to spread.
+
+  Filter::processZeroPhase()
+
+  For offline work, filters whole signals forwards and then backwards,
+  which leaves no phase shift and squares the magnitude response, like
+  filtfilt() elsewhere. The ends are extended by odd reflections and both
+  passes start from steady state, so the edges do not ring. The output
+  goes to separate buffers and the channel state is left alone. Long
+  signals are cut into overlapping chunks which run on the worker pool,
+  if one was given, in bounded memory; the joins match filtering in one
+  piece to about ten decimal places. The ZeroPhase class template in
+  ZeroPhase.h does the same for any Cascade or Biquad, and allows the
+  chunk size and overlap to be chosen.
+
+  Forward filtering of a single long channel cannot be split the same
+  way, since the output should match a single pass. SegmentedFilter in
+  SegmentedFilter.h filters the segments of each block from rest on the
+  threads of a pool, then runs the start of each one again from the end
+  state of the segment before it, until the difference has decayed. It
+  keeps its own state from one block to the next.
+
+  Filters with edges close to Nyquist are bent out of shape by the
+  bilinear transform. Oversampler in Oversampler.h runs any Filter at 2,
+  4 or 8 times the rate of the signal, which must be the rate the filter
+  was set up for. Each doubling uses a Halfband: two branches of first
+  order allpass sections in z^-2, which cost one multiply per coefficient
+  at the lower rate. The default 96dB of alias rejection at 2x takes 21
+  multiplies per sample for the round trip, where a direct form elliptic
+  filter of the same order would take ten times as many.
+
   To create a Filter object, use operator new on a subclass template with
   appropriate parameters based on the type of filter you want. Here are the
   subclasses.
@@ -185,10 +270,34 @@ class FilterDesign : public Filter
   to use for processing samples. Channels may be zero, in which case the
   object can only be used for analysis.
 
+  Channels may also be dynamicChannels, in which case the number of
+  channels is chosen at run time by calling setNumChannels(), which resets
+  them. The states of all the channels are kept together in one block of
+  memory aligned to a cache line. One instantiation then serves every
+  channel layout, with the same lock-step processing as a fixed count.
+  SimpleFilter accepts dynamicChannels in the same way.
+
   Because the DesignClass is a member and not inherited, it is in general
   not possible to call members of the DesignClass directly. You must go
   through the Filter interface.
 
+  When there is more than one channel, and the StateType is DirectFormI,
+  DirectFormII or TransposedDirectFormII, groups of channels are processed
+  in lock-step using SSE2 or AVX when the compiler enables them. The output
+  is identical to processing each channel separately.
+
+  Each realization is a template on the precision of its state and
+  arithmetic: BasicDirectFormII <float>, BasicDirectFormII <long double>,
+  and so on. DirectFormII itself is BasicDirectFormII <double>. With float
+  the coefficients are rounded to single precision when the filter is
+  designed, and samples are processed entirely in single precision, twice
+  as many channels at a time. Filters are always designed in double
+  precision, so long double state uses the double coefficients. A raw
+  cascade keeps only the double coefficients; the wrappers ask it for
+  single precision copies when their StateType reads float, and without
+  them float state rounds the double stages as it goes, to the same
+  result.
+
 
 
 template <class DesignClass, int Channels, class StateType = DirectFormII>
@@ -202,6 +311,14 @@ class SmoothedFilterDesign : public Filter
   caller, except that the constructor takes an additional parameter that
   indicates the duration of transitions when parameters change.
 
+  By default the filter is redesigned at every sample of a transition,
+  which gets expensive for high order pole filters. An optional second
+  constructor parameter (or setControlInterval) sets the number of samples
+  between redesigns. In between, the coefficients of the cascade stages are
+  interpolated and the gain is normalized again, which is much cheaper than
+  designing the filter. An interval at least as long as the transition only
+  designs the two endpoints.
+
 
 
 template <class FilterClass, int Channels = 0, class StateType = DirectFormII>
@@ -224,6 +341,88 @@ class SimpleFilter : public FilterClass
   or after changing parameters, to clear the state and prevent audible
   artifacts.
 
+  Raw filters built from a cascade of second order sections offer
+  setProcessing(), which chooses between running each sample through all
+  of the stages (Cascade::sampleMajor, the default) or running each stage
+  over a tile of samples before the next (Cascade::stageMajor). The output
+  is identical; which one is faster depends on the filter order and the
+  processor.
+
+  Cascade::parallel expands the cascade into a sum of independent second
+  order sections plus a direct term (a partial fraction expansion of the
+  poles). The sections do not wait on each other, so even a single channel
+  runs several of them at once in SIMD lanes. The expansion is poorly
+  conditioned when many poles crowd together, as they do in high order
+  Butterworth filters with a low cutoff, so its error is estimated when
+  the filter is set up and process() falls back to sampleMajor when it
+  would exceed Cascade::maxParallelError. usesParallel() tells which one
+  runs. Call reset() when switching to or from it. The sections are only
+  allocated the first time it is selected. The program in
+  benchmarks/CascadeProcessing.cpp measures all three.
+
+
+
+template <class FilterClass, class StateType = DirectFormII>
+class SizedFilter : public FilterClass::base_t
+
+  A raw filter holds storage for the largest order its template allows,
+  and so does the state of every channel, whatever order it is set up
+  with. SizedFilter takes the maximum order and the number of channels
+  when it is constructed, and allocates stages, pole/zero layouts and
+  channel state for exactly that from an Arena, a block of memory
+  supplied by the caller:
+
+    char memory [16384];
+    Dsp::Arena arena (memory, sizeof (memory));
+    Dsp::SizedFilter <Dsp::Butterworth::LowPass <50> > f (arena, 4, 2);
+    f.setup (4, 44100, 1000);
+    f.process (numSamples, audioData);
+
+  The MaxOrder of the FilterClass is only an upper limit here. Thousands
+  of low order filters can share one arena, and Arena::allocate() throws
+  std::bad_alloc once it is full. The setup() called is the one of the
+  factored base; for Bessel and Legendre it takes a Workspace as its last
+  argument. A SizedFilter cannot be copied, and the arena must outlive it.
+  Single precision copies of the stages are only taken when the StateType
+  reads float, and the sections of Cascade::parallel only when
+  setProcessing() first selects it.
+
+
+
+template <class StateType = DirectFormII>
+class FilterBank
+
+  Runs a single channel through many raw filters at once and writes a
+  separate output for each, as in an octave or third octave analyzer.
+  setFilters() takes an array of pointers to designed cascades and copies
+  their coefficients; call it again after changing any of them. process()
+  takes the input block and an array of output channels, one per filter.
+
+  The filters are placed in the lanes of a vector, so each group of them
+  costs about as much as one cascade processed alone. Shorter cascades are
+  padded with stages that leave the signal unchanged, so the bank costs
+  the same as if every filter had as many stages as the longest.
+
+
+
+template <class StateType = DirectFormII>
+class VoiceBank
+
+  Runs many voices through a second order section each, in place, one
+  channel per voice, as in a polyphonic synthesizer. setNumVoices() sizes
+  the state. process() takes the channels and a BiquadArrays, which holds
+  the coefficients as a structure of arrays with one array per
+  coefficient. Voices are processed a group at a time in vector lanes.
+
+  The arrays can be filled in one call per control tick by the batch
+  designs in RBJ::Batch, which take arrays of sample rates, frequencies
+  and Q, gain or slope, and design a vector of filters at a time. Their
+  sines and exponentials are the polynomial approximations vectorSin(),
+  vectorExp() and vectorExpm1() from Simd.h, with error bounds given
+  there. The sines are taken of the distance to DC or to Nyquist, so
+  for gains within +/-60dB the normalized coefficients are within 1e-13
+  of the exact formulae over the whole band; RBJ.h has the details.
+
 
 
 Filter family namespaces
@@ -259,6 +458,14 @@ Filter family namespaces
   changing filter settings. All they offer is a setup() function for updating
   the IIR coefficients to a given set of parameters.
 
+  Designs made by setup() go into a cache shared by every thread, so that
+  many instances with the same settings only pay for the design once. The
+  poles of the Bessel and Legendre prototypes come from tables up to order
+  50. Above that, and for Elliptic filters and Bessel shelves, the analog
+  prototypes are worked out numerically and cached as well. The cache keeps
+  the most recently used designs, up to DesignCache::defaultCapacity of
+  them; DesignCache::setCapacity() changes the limit, and zero turns it off.
+
 <class DesignClass>
 
   Each filter family namespace also has the nested namespace "Design". Inside
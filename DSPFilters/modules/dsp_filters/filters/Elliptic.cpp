@@ -81,6 +81,10 @@ void AnalogLowPass::design (int numPoles,
     m_rippleDb = rippleDb;
     m_rolloff = rolloff;
 
+    const DesignKey key ("Elliptic Analog Low Pass", numPoles, rippleDb, rolloff);
+    if (DesignCache::findLayout (key, *this))
+      return;
+
     reset ();
 
     // calculate
@@ -162,6 +166,8 @@ void AnalogLowPass::design (int numPoles,
     }
 
     setNormal (0, (numPoles&1) ? 1. : pow (10., -rippleDb / 20.0));
+
+    DesignCache::storeLayout (key, *this);
   }
 }
 
@@ -318,6 +324,11 @@ void LowPassBase::setup (int order,
                          double rippleDb,
                          double rolloff)
 {
+  const DesignKey key ("Elliptic Low Pass", order, cutoffFrequency / sampleRate,
+                       rippleDb, rolloff);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb, rolloff);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -325,6 +336,8 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
@@ -333,6 +346,11 @@ void HighPassBase::setup (int order,
                           double rippleDb,
                           double rolloff)
 {
+  const DesignKey key ("Elliptic High Pass", order,
+                       cutoffFrequency / sampleRate, rippleDb, rolloff);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb, rolloff);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -340,6 +358,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -349,6 +369,12 @@ void BandPassBase::setup (int order,
                           double rippleDb,
                           double rolloff)
 {
+  const DesignKey key ("Elliptic Band Pass", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, rippleDb, rolloff);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb, rolloff);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -357,6 +383,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -366,6 +394,12 @@ void BandStopBase::setup (int order,
                           double rippleDb,
                           double rolloff)
 {
+  const DesignKey key ("Elliptic Band Stop", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate, rippleDb, rolloff);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, rippleDb, rolloff);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -374,6 +408,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
@@ -51,6 +51,44 @@ Filter::~Filter()
 {
 }
 
+void Filter::response (int numFrequencies,
+                       const double* normalizedFrequencies,
+                       complex_t* dest) const
+{
+  for (int i = 0; i < numFrequencies; ++i)
+    dest[i] = response (normalizedFrequencies[i]);
+}
+
+void Filter::response (int numFrequencies,
+                       double first,
+                       double spacing,
+                       complex_t* dest) const
+{
+  for (int i = 0; i < numFrequencies; ++i)
+    dest[i] = response (first + i * spacing);
+}
+
+void Filter::response (FrequencyResponse::Measure measure,
+                       int numFrequencies,
+                       const double* normalizedFrequencies,
+                       double* dest) const
+{
+  for (int i = 0; i < numFrequencies; ++i)
+    dest[i] = FrequencyResponse::measureOf (
+      measure, response (normalizedFrequencies[i]));
+}
+
+void Filter::response (FrequencyResponse::Measure measure,
+                       int numFrequencies,
+                       double first,
+                       double spacing,
+                       double* dest) const
+{
+  for (int i = 0; i < numFrequencies; ++i)
+    dest[i] = FrequencyResponse::measureOf (
+      measure, response (first + i * spacing));
+}
+
 int Filter::findParamId (int paramId)
 {
   int index = -1;
@@ -98,11 +98,56 @@ public:
  
   virtual complex_t response (double normalizedFrequency) const = 0;
 
+  // Calculate the response at many frequencies at once. This is much
+  // faster than calling response() for each one. The forms taking
+  // first and spacing are for evenly spaced frequencies. See
+  // FrequencyResponse for the measures.
+  virtual void response (int numFrequencies,
+                         const double* normalizedFrequencies,
+                         complex_t* dest) const;
+
+  virtual void response (int numFrequencies,
+                         double first,
+                         double spacing,
+                         complex_t* dest) const;
+
+  virtual void response (FrequencyResponse::Measure measure,
+                         int numFrequencies,
+                         const double* normalizedFrequencies,
+                         double* dest) const;
+
+  virtual void response (FrequencyResponse::Measure measure,
+                         int numFrequencies,
+                         double first,
+                         double spacing,
+                         double* dest) const;
+
   virtual int getNumChannels() = 0;
   virtual void reset () = 0;
+
+  // Spreads the channels given to process() over the threads of the
+  // pool, zero goes back to the calling thread alone.
+  virtual void setWorkerPool (WorkerPool* pool) = 0;
+
   virtual void process (int numSamples, float* const* arrayOfChannels) = 0;
   virtual void process (int numSamples, double* const* arrayOfChannels) = 0;
 
+  // Process channels interleaved frame by frame, in place, without
+  // separating them first. numChannels must match getNumChannels(),
+  // or std::logic_error is thrown.
+  virtual void processInterleaved (int numFrames, int numChannels, float* data) = 0;
+  virtual void processInterleaved (int numFrames, int numChannels, double* data) = 0;
+
+  // Filters whole signals forwards and backwards, for zero phase,
+  // without touching the channel state. src and dest may not overlap.
+  // Uses the pool given to setWorkerPool(). See ZeroPhase.
+  virtual void processZeroPhase (int numChannels, size_t numSamples,
+                                 const float* const* src,
+                                 float* const* dest) = 0;
+  virtual void processZeroPhase (int numChannels, size_t numSamples,
+                                 const double* const* src,
+                                 double* const* dest) = 0;
+
 protected:
   virtual void doSetParams (const Params& parameters) = 0;
 
@@ -173,6 +218,42 @@ public:
     return m_design.response (normalizedFrequency);
   }
 
+  void response (int numFrequencies,
+                 const double* normalizedFrequencies,
+                 complex_t* dest) const
+  {
+    FrequencyResponse (m_design).evaluate (
+      numFrequencies, normalizedFrequencies, dest);
+  }
+
+  void response (int numFrequencies,
+                 double first,
+                 double spacing,
+                 complex_t* dest) const
+  {
+    FrequencyResponse (m_design).evaluate (
+      numFrequencies, first, spacing, dest);
+  }
+
+  void response (FrequencyResponse::Measure measure,
+                 int numFrequencies,
+                 const double* normalizedFrequencies,
+                 double* dest) const
+  {
+    FrequencyResponse (m_design).evaluate (
+      measure, numFrequencies, normalizedFrequencies, dest);
+  }
+
+  void response (FrequencyResponse::Measure measure,
+                 int numFrequencies,
+                 double first,
+                 double spacing,
+                 double* dest) const
+  {
+    FrequencyResponse (m_design).evaluate (
+      measure, numFrequencies, first, spacing, dest);
+  }
+
 protected:
   void doSetParams (const Params& parameters)
   {
@@ -193,11 +274,19 @@ class FilterDesign : public FilterDesignBase <DesignClass>
 public:
   FilterDesign ()
   {
+    DesignClass::template State <StateType>::attach (
+      FilterDesignBase<DesignClass>::m_design);
   }
 
   int getNumChannels()
   {
-    return Channels;
+    return m_state.getNumChannels();
+  }
+
+  // Only for Channels == dynamicChannels. Resets every channel.
+  void setNumChannels (int numChannels)
+  {
+    m_state.setNumChannels (numChannels);
   }
 
   void reset ()
@@ -205,6 +294,11 @@ public:
     m_state.reset();
   }
 
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_state.setWorkerPool (pool);
+  }
+
   void process (int numSamples, float* const* arrayOfChannels)
   {
     m_state.process (numSamples, arrayOfChannels,
@@ -217,6 +311,38 @@ public:
                      FilterDesignBase<DesignClass>::m_design);
   }
 
+  void processInterleaved (int numFrames, int numChannels, float* data)
+  {
+    if (numChannels != getNumChannels ())
+      throw std::logic_error ("wrong number of interleaved channels");
+    m_state.processInterleaved (numFrames, data,
+                                FilterDesignBase<DesignClass>::m_design);
+  }
+
+  void processInterleaved (int numFrames, int numChannels, double* data)
+  {
+    if (numChannels != getNumChannels ())
+      throw std::logic_error ("wrong number of interleaved channels");
+    m_state.processInterleaved (numFrames, data,
+                                FilterDesignBase<DesignClass>::m_design);
+  }
+
+  void processZeroPhase (int numChannels, size_t numSamples,
+                         const float* const* src, float* const* dest)
+  {
+    ZeroPhase <StateType> filter (FilterDesignBase<DesignClass>::m_design);
+    filter.setWorkerPool (m_state.getWorkerPool ());
+    filter.process (numChannels, numSamples, src, dest);
+  }
+
+  void processZeroPhase (int numChannels, size_t numSamples,
+                         const double* const* src, double* const* dest)
+  {
+    ZeroPhase <StateType> filter (FilterDesignBase<DesignClass>::m_design);
+    filter.setWorkerPool (m_state.getWorkerPool ());
+    filter.process (numChannels, numSamples, src, dest);
+  }
+
 protected:
   ChannelsState <Channels,
                  typename DesignClass::template State <StateType> > m_state;
@@ -237,9 +363,20 @@ template <class FilterClass,
 class SimpleFilter : public FilterClass
 {
 public:
+  SimpleFilter ()
+  {
+    FilterClass::template State <StateType>::attach (*this);
+  }
+
   int getNumChannels()
   {
-    return Channels;
+    return m_state.getNumChannels();
+  }
+
+  // Only for Channels == dynamicChannels. Resets every channel.
+  void setNumChannels (int numChannels)
+  {
+    m_state.setNumChannels (numChannels);
   }
 
   void reset ()
@@ -247,17 +384,181 @@ public:
     m_state.reset();
   }
 
+  // Spreads the channels over the threads of the pool
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_state.setWorkerPool (pool);
+  }
+
   template <typename Sample>
   void process (int numSamples, Sample* const* arrayOfChannels)
   {
     m_state.process (numSamples, arrayOfChannels, *((FilterClass*)this));
   }
 
+  // Process channels interleaved frame by frame, in place.
+  // numChannels must match getNumChannels(), or std::logic_error is
+  // thrown.
+  template <typename Sample>
+  void processInterleaved (int numFrames, int numChannels, Sample* data)
+  {
+    if (numChannels != getNumChannels ())
+      throw std::logic_error ("wrong number of interleaved channels");
+    m_state.processInterleaved (numFrames, data, *((FilterClass*)this));
+  }
+
 protected:
   ChannelsState <Channels,
                  typename FilterClass::template State <StateType> > m_state;
 };
 
+
+//------------------------------------------------------------------------------
+
+/*
+ * Like SimpleFilter, but the stages, the pole/zero layouts and the
+ * state of every channel are sized for maxOrder when constructed and
+ * taken from the caller's Arena. The raw filter's own MaxOrder is only
+ * an upper limit, so SizedFilter <Butterworth::LowPass <50> > set up
+ * with a maxOrder of 4 takes a small fraction of the memory of the
+ * raw filter. Single precision stages are only taken for a StateType
+ * which reads them, and the sections of the parallel form only when
+ * setProcessing() first selects it. The arena must outlive the filter.
+ *
+ * Set it up by calling the setup function of the raw filter's factored
+ * base. For Bessel and Legendre that function also takes a Workspace.
+ *
+ */
+template <class FilterClass,
+          class StateType = DirectFormII>
+class SizedFilter : public FilterClass::base_t
+{
+public:
+  typedef typename FilterClass::base_t base_t;
+
+  SizedFilter (Arena& arena, int maxOrder, int numChannels)
+    : m_arena (&arena)
+    , m_sections (false)
+    , m_maxOrder (maxOrder)
+    , m_numChannels (numChannels)
+    , m_pool (0)
+  {
+    assert (maxOrder > 0 && maxOrder <= FilterClass::maxOrder);
+    assert (numChannels >= 0);
+
+    const int maxAnalogPoles = maxOrder;
+    const int maxDigitalPoles = maxOrder * FilterClass::digitalPolesPerOrder;
+    const int maxStages = (maxDigitalPoles + 1) / 2;
+
+    base_t::setCascadeStorage (Cascade::Storage (maxStages,
+      arena.allocateArray <Cascade::Stage> (maxStages)));
+    attachStages (typename StateType::coefficient_t ());
+
+    base_t::setPrototypeStorage (
+      LayoutBase (maxAnalogPoles, arena.allocateArray <PoleZeroPair> (
+        (maxAnalogPoles + 1) / 2)),
+      LayoutBase (maxDigitalPoles, arena.allocateArray <PoleZeroPair> (
+        (maxDigitalPoles + 1) / 2)));
+
+    // one array of stage states for all channels, in channel order
+    StateType* stageStates = arena.allocateArray <StateType> (
+      numChannels * maxStages);
+    m_state = static_cast<state_t*> (
+      arena.allocate (numChannels * sizeof (state_t)));
+    for (int i = 0; i < numChannels; ++i)
+      new (m_state + i) state_t (stageStates + i * maxStages, maxStages);
+  }
+
+  int getMaxOrder () const
+  {
+    return m_maxOrder;
+  }
+
+  // Takes the sections of the parallel form from the arena the first
+  // time it is selected, then works like Cascade::setProcessing()
+  void setProcessing (Cascade::Processing processing, int blockSize = 0)
+  {
+    if (processing == Cascade::parallel && !m_sections)
+    {
+      m_sections = true;
+      base_t::setSectionStorage (
+        m_arena->allocateArray <Cascade::Section> (getMaxStages ()));
+    }
+
+    base_t::setProcessing (processing, blockSize);
+  }
+
+  int getNumChannels () const
+  {
+    return m_numChannels;
+  }
+
+  void reset ()
+  {
+    for (int i = 0; i < m_numChannels; ++i)
+      m_state[i].reset();
+  }
+
+  // Spreads the channels over the threads of the pool
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_pool = pool;
+  }
+
+  template <typename Sample>
+  void process (int numSamples, Sample* const* arrayOfChannels)
+  {
+    DenormalGuard guard;
+
+    processChannels (numSamples, m_numChannels, arrayOfChannels, m_state,
+                     static_cast<base_t&> (*this), m_pool);
+  }
+
+  // Process channels interleaved frame by frame, in place.
+  // numChannels must match getNumChannels(), or std::logic_error is
+  // thrown.
+  template <typename Sample>
+  void processInterleaved (int numFrames, int numChannels, Sample* data)
+  {
+    if (numChannels != getNumChannels ())
+      throw std::logic_error ("wrong number of interleaved channels");
+    DenormalGuard guard;
+
+    Dsp::processInterleaved (numFrames, m_numChannels, data, m_state,
+                             static_cast<base_t&> (*this));
+  }
+
+private:
+  SizedFilter (const SizedFilter&);
+  SizedFilter& operator= (const SizedFilter&);
+
+  int getMaxStages () const
+  {
+    return (m_maxOrder * FilterClass::digitalPolesPerOrder + 1) / 2;
+  }
+
+  // Single precision stages, for state which reads float coefficients
+  void attachStages (float)
+  {
+    base_t::setSingleStageStorage (
+      m_arena->allocateArray <Cascade::SingleStage> (getMaxStages ()));
+  }
+
+  void attachStages (double)
+  {
+  }
+
+private:
+  typedef SizedState <StateType> state_t;
+
+  Arena* m_arena;
+  bool m_sections;
+  int m_maxOrder;
+  int m_numChannels;
+  state_t* m_state;
+  WorkerPool* m_pool;
+};
+
 }
 
 #endif
@@ -0,0 +1,266 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_FILTERBANK_H
+#define DSPFILTERS_FILTERBANK_H
+
+namespace Dsp {
+
+/*
+ * Runs one channel through many cascades at once, such as the bands
+ * of an octave or third octave analyzer, writing one output for each.
+ *
+ * The filters are mapped to the lanes of a vector, so a group of them
+ * is processed with the instructions that would otherwise run just
+ * one. Filters with fewer stages than the longest one are padded with
+ * stages that pass the signal through unchanged. Each block of input
+ * is read once, converted to the precision of the state, and stays in
+ * the cache while every group filters it.
+ *
+ */
+
+// Processes one group of filters, one filter in each lane of Vector
+template <bool Supported>
+struct BankGroup
+{
+  template <class Vector, class StateType, typename Sample>
+  static void process (int numSamples,
+                       const typename StateType::value_t* in,
+                       Sample* const* dest,
+                       int numStages,
+                       const BiquadCoefficients <typename StateType::coefficient_t>* stages,
+                       StateType* states)
+  {
+    typedef typename StateType::template Lanes <Vector> lanes_t;
+
+    const Vector zero (0);
+    Vector buf [laneBlockSize];
+
+    for (int i = 0; i < numSamples; ++i)
+      buf[i] = Vector (in[i]);
+
+    for (int j = 0; j < numStages; ++j)
+    {
+      lanes_t lanes;
+      for (int l = 0; l < Vector::lanes; ++l)
+      {
+        lanes.setCoefficients (l, *stages++);
+        lanes.load (l, states[l]);
+      }
+
+      for (int i = 0; i < numSamples; ++i)
+        buf[i] = lanes.process1 (buf[i], zero);
+
+      for (int l = 0; l < Vector::lanes; ++l)
+        lanes.store (l, *states++);
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+      buf[i].store (dest, i);
+  }
+};
+
+// Realizations without Lanes have groups of a single filter
+template <>
+struct BankGroup <false>
+{
+  template <class Vector, class StateType, typename Sample>
+  static void process (int numSamples,
+                       const typename StateType::value_t* in,
+                       Sample* const* dest,
+                       int numStages,
+                       const BiquadCoefficients <typename StateType::coefficient_t>* stages,
+                       StateType* states)
+  {
+    typedef typename StateType::value_t value_t;
+
+    value_t buf [laneBlockSize];
+
+    for (int i = 0; i < numSamples; ++i)
+      buf[i] = in[i];
+
+    for (int j = 0; j < numStages; ++j, ++stages, ++states)
+    {
+      StateType state = *states;
+
+      for (int i = 0; i < numSamples; ++i)
+        buf[i] = state.process1 (buf[i], *stages, 0);
+
+      *states = state;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+      dest[0][i] = static_cast<Sample> (buf[i]);
+  }
+};
+
+//------------------------------------------------------------------------------
+
+template <class StateType = DirectFormII>
+class FilterBank : private DenormalPrevention
+{
+public:
+  typedef typename StateType::value_t value_t;
+  typedef typename StateType::coefficient_t coefficient_t;
+  typedef BiquadCoefficients <coefficient_t> stage_t;
+
+  enum
+  {
+    supportsLanes = LaneTraits <StateType>::supported,
+
+    // Number of filters processed together
+    groupSize = supportsLanes ? LaneWidth <value_t>::max : 1
+  };
+
+  FilterBank ()
+    : m_numFilters (0)
+    , m_numStages (0)
+  {
+  }
+
+  int getNumFilters () const
+  {
+    return m_numFilters;
+  }
+
+  // Copies the coefficients of each cascade, which may be changed or
+  // destroyed afterwards. Call again after redesigning them. The state
+  // carries on if the number of filters and of stages stays the same,
+  // otherwise the filters start out reset.
+  void setFilters (int numFilters, const Cascade* const* filters)
+  {
+    assert (numFilters >= 0);
+
+    int numStages = 0;
+    for (int i = 0; i < numFilters; ++i)
+      numStages = std::max (numStages, filters[i]->getNumStages ());
+
+    const int numGroups = (numFilters + groupSize - 1) / groupSize;
+    const size_t size = size_t (numGroups) * numStages * groupSize;
+
+    stage_t identity;
+    identity.m_a0 = 1;
+    identity.m_a1 = 0;
+    identity.m_a2 = 0;
+    identity.m_b0 = 1;
+    identity.m_b1 = 0;
+    identity.m_b2 = 0;
+
+    m_stages.assign (size, identity);
+
+    for (int i = 0; i < numFilters; ++i)
+    {
+      const Cascade& c = *filters[i];
+      for (int j = 0; j < c.getNumStages (); ++j)
+        m_stages[index (i, j, numStages)] = stage_t (c[j]);
+    }
+
+    if (numFilters != m_numFilters || numStages != m_numStages)
+    {
+      m_states.assign (size, StateType ());
+      m_numFilters = numFilters;
+      m_numStages = numStages;
+    }
+  }
+
+  void reset ()
+  {
+    for (size_t i = 0; i < m_states.size (); ++i)
+      m_states[i].reset ();
+  }
+
+  // Filters numSamples of src into the output of each filter.
+  // src may be one of the outputs.
+  template <typename Sample>
+  void process (int numSamples,
+                const Sample* src,
+                Sample* const* destArrayOfFilters)
+  {
+    typedef LaneVector <groupSize, value_t> vector_t;
+
+    DenormalGuard guard;
+
+    if (numSamples <= 0 || m_numFilters == 0)
+      return;
+
+    value_t vsa = value_t (ac());
+    if (!(numSamples & 1))
+      ac();
+
+    value_t in [laneBlockSize];
+    Sample unused [laneBlockSize];
+    Sample* dest [groupSize];
+
+    for (int offset = 0; offset < numSamples; offset += laneBlockSize)
+    {
+      const int n = std::min (numSamples - offset, int (laneBlockSize));
+
+      for (int i = 0; i < n; ++i)
+      {
+        in[i] = add_denormal_offset (static_cast<value_t> (src[offset + i]), vsa);
+        vsa = -vsa;
+      }
+
+      for (int first = 0; first < m_numFilters; first += groupSize)
+      {
+        for (int l = 0; l < groupSize; ++l)
+          dest[l] = first + l < m_numFilters ?
+            destArrayOfFilters[first + l] + offset : unused;
+
+        const size_t i = index (first, 0, m_numStages);
+        BankGroup <supportsLanes>::template process <vector_t> (
+          n, in, dest, m_numStages, &m_stages[i], &m_states[i]);
+      }
+    }
+  }
+
+private:
+  // Filters are grouped, then each group is ordered by stage
+  static size_t index (int filter, int stage, int numStages)
+  {
+    return (size_t (filter / groupSize) * numStages + stage) * groupSize +
+           filter % groupSize;
+  }
+
+private:
+  int m_numFilters;
+  int m_numStages;
+  std::vector<stage_t> m_stages;
+  std::vector<StateType> m_states;
+};
+
+}
+
+#endif
@@ -132,6 +132,15 @@ public:
     return m_normalGain;
   }
 
+  // Replaces the poles and zeros with a copy of the given pairs
+  void setPairs (int numPoles, const PoleZeroPair* pairs)
+  {
+    assert (numPoles <= m_maxPoles);
+    m_numPoles = numPoles;
+    for (int i = 0; i < (numPoles + 1) / 2; ++i)
+      m_pair[i] = pairs[i];
+  }
+
   void setNormal (double w, double g)
   {
     m_normalW = w;
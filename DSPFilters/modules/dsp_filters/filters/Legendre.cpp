@@ -233,6 +233,13 @@ void AnalogLowPass::design (int numPoles,
   {
     m_numPoles = numPoles;
 
+    if (analogPoles.design (*this, numPoles))
+      return;
+
+    const DesignKey key ("Legendre Analog Low Pass", numPoles);
+    if (DesignCache::findLayout (key, *this))
+      return;
+
     reset ();
 
     PolynomialFinderBase& poly (w->poly);
@@ -266,6 +273,8 @@ void AnalogLowPass::design (int numPoles,
 
     if (numPoles & 1)
       add (poles.root()[pairs].real(), infinity());
+
+    DesignCache::storeLayout (key, *this);
   }
 }
 
@@ -276,6 +285,11 @@ void LowPassBase::setup (int order,
                          double cutoffFrequency,
                          WorkspaceBase* w)
 {
+  const DesignKey key ("Legendre Low Pass", order,
+                       cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   LowPassTransform (cutoffFrequency / sampleRate,
@@ -283,6 +297,8 @@ void LowPassBase::setup (int order,
                     m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void HighPassBase::setup (int order,
@@ -290,6 +306,11 @@ void HighPassBase::setup (int order,
                           double cutoffFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Legendre High Pass", order,
+                       cutoffFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   HighPassTransform (cutoffFrequency / sampleRate,
@@ -297,6 +318,8 @@ void HighPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandPassBase::setup (int order,
@@ -305,6 +328,12 @@ void BandPassBase::setup (int order,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Legendre Band Pass", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   BandPassTransform (centerFrequency / sampleRate,
@@ -313,6 +342,8 @@ void BandPassBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 void BandStopBase::setup (int order,
@@ -321,6 +352,12 @@ void BandStopBase::setup (int order,
                           double widthFrequency,
                           WorkspaceBase* w)
 {
+  const DesignKey key ("Legendre Band Stop", order,
+                       centerFrequency / sampleRate,
+                       widthFrequency / sampleRate);
+  if (findDesign (key))
+    return;
+
   m_analogProto.design (order, w);
 
   BandStopTransform (centerFrequency / sampleRate,
@@ -329,6 +366,8 @@ void BandStopBase::setup (int order,
                      m_analogProto);
 
   Cascade::setLayout (m_digitalProto);
+
+  storeDesign (key);
 }
 
 }
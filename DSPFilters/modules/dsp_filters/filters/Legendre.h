@@ -139,6 +139,9 @@ private:
 
 //------------------------------------------------------------------------------
 
+// Poles of the low pass prototype
+extern const PoleTable analogPoles;
+
 // Half-band analog prototypes (s-plane)
 
 class AnalogLowPass : public LayoutBase
@@ -117,8 +117,38 @@ inline bool is_nan<complex_t> (complex_t v)
 /*
  * Hack to prevent denormals
  *
+ * Defining DSPFILTERS_FLUSH_DENORMALS replaces the hack with the
+ * flush to zero and denormals are zero modes of the processor,
+ * set by a ScopedFlushDenormals around each call to process. The
+ * small amount is then zero and the additions of it compile out.
+ *
  */
 
+#ifdef DSPFILTERS_FLUSH_DENORMALS
+
+class DenormalPrevention
+{
+public:
+  inline double ac ()
+  {
+    return 0;
+  }
+
+  static inline double dc ()
+  {
+    return 0;
+  }
+};
+
+// the hardware takes care of it
+template <typename Ty>
+inline Ty add_denormal_offset (const Ty& v, const Ty&)
+{
+  return v;
+}
+
+#else
+
 //const double anti_denormal_vsa = 1e-16; // doesn't prevent denormals
 //const double anti_denormal_vsa = 0;
 const double anti_denormal_vsa = 1e-8;
@@ -147,6 +177,14 @@ private:
   double m_v;
 };
 
+template <typename Ty>
+inline Ty add_denormal_offset (const Ty& v, const Ty& vsa)
+{
+  return v + vsa;
+}
+
+#endif
+
 }
 
 #endif
@@ -0,0 +1,234 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+namespace Dsp {
+
+// The allpass coefficients are those of an odd order elliptic halfband
+// filter, found with the series for the elliptic functions given by
+// Valenzuela and Constantinides. k is the selectivity and q the nome.
+namespace {
+
+struct HalfbandSpec
+{
+  explicit HalfbandSpec (double transition)
+  {
+    const double t = std::tan ((1 - 2 * transition) * doublePi / 4);
+    k = t * t;
+
+    const double kk = std::pow (1 - k * k, 0.25);
+    const double e = 0.5 * (1 - kk) / (1 + kk);
+    const double e4 = e * e * e * e;
+    q = e * (1 + e4 * (2 + e4 * (15 + 150 * e4)));
+  }
+
+  double coefficient (int index, int order) const
+  {
+    const double c = index + 1;
+
+    double num = 0;
+    double term;
+    int i = 0;
+    do
+    {
+      term = std::pow (q, double (i * (i + 1))) *
+             std::sin ((2 * i + 1) * c * doublePi / order);
+      num += (i & 1) ? -term : term;
+      ++i;
+    }
+    while (std::fabs (term) > 1e-100);
+    num *= std::pow (q, 0.25);
+
+    double den = 0.5;
+    i = 1;
+    do
+    {
+      term = std::pow (q, double (i * i)) *
+             std::cos (2 * i * c * doublePi / order);
+      den += (i & 1) ? -term : term;
+      ++i;
+    }
+    while (std::fabs (term) > 1e-100);
+
+    const double w = num / den;
+    const double w2 = w * w;
+    const double x = std::sqrt ((1 - w2 * k) * (1 - w2 / k)) / (1 + w2);
+    return (1 - x) / (1 + x);
+  }
+
+  double k;
+  double q;
+};
+
+}
+
+Halfband::State::State ()
+{
+  reset ();
+}
+
+void Halfband::State::reset ()
+{
+  std::fill (m_x, m_x + maxCoefficients, 0.);
+  std::fill (m_y, m_y + maxCoefficients, 0.);
+}
+
+Halfband::Halfband ()
+  : m_numCoefficients (0)
+{
+}
+
+int Halfband::getNumCoefficients (double attenuationDb, double transition)
+{
+  if (transition <= 0 || transition >= 0.5)
+    throw std::logic_error ("halfband transition out of range");
+
+  const HalfbandSpec spec (transition);
+  const double r = std::pow (10., -attenuationDb / 10);
+  const double a = r / (1 - r);
+
+  int order = int (std::ceil (std::log (a * a / 16) / std::log (spec.q)));
+  order = std::max (order | 1, 3);
+
+  return std::min ((order - 1) / 2, int (maxCoefficients));
+}
+
+void Halfband::setup (double attenuationDb, double transition)
+{
+  setupCoefficients (getNumCoefficients (attenuationDb, transition),
+                     transition);
+}
+
+void Halfband::setupCoefficients (int numCoefficients, double transition)
+{
+  if (numCoefficients < 1 || numCoefficients > maxCoefficients)
+    throw std::logic_error ("invalid number of halfband coefficients");
+  if (transition <= 0 || transition >= 0.5)
+    throw std::logic_error ("halfband transition out of range");
+
+  const HalfbandSpec spec (transition);
+  const int order = 2 * numCoefficients + 1;
+
+  m_numCoefficients = numCoefficients;
+  for (int i = 0; i < numCoefficients; ++i)
+    m_coefficients[i] = spec.coefficient (i, order);
+}
+
+complex_t Halfband::response (double normalizedFrequency) const
+{
+  const double w = 2 * doublePi * normalizedFrequency;
+  const complex_t z1 = std::polar (1., -w);
+  const complex_t z2 = z1 * z1;
+
+  complex_t branch[2] = { 1, 1 };
+  for (int j = 0; j < m_numCoefficients; ++j)
+  {
+    const double a = m_coefficients[j];
+    branch[j & 1] *= (a + z2) / (1. + a * z2);
+  }
+
+  return 0.5 * (branch[0] + z1 * branch[1]);
+}
+
+//------------------------------------------------------------------------------
+
+Oversampler::Oversampler (Filter& filter,
+                          int factor,
+                          double attenuationDb,
+                          double transition)
+  : m_filter (filter)
+  , m_factor (factor)
+  , m_numStages (0)
+{
+  switch (factor)
+  {
+  case 2: m_numStages = 1; break;
+  case 4: m_numStages = 2; break;
+  case 8: m_numStages = 3; break;
+  default:
+    throw std::logic_error ("oversampling factor must be 2, 4 or 8");
+  }
+
+  // Stage j runs at 2^j times the signal's rate, where the passband
+  // edge is 2^j times closer to DC and the transition widens to match.
+  for (int j = 0; j < m_numStages; ++j)
+    m_stages[j].setup (attenuationDb,
+                       0.5 - (0.5 - transition) / (1 << j));
+
+  prepare (m_filter.getNumChannels ());
+}
+
+int Oversampler::getNumMultiplies () const
+{
+  // each stage does its coefficients and the 1/2 of the decimator per
+  // low rate sample, once up and once down
+  int count = 0;
+  for (int j = 0; j < m_numStages; ++j)
+    count += (2 * m_stages[j].getNumCoefficients () + 1) << j;
+  return count;
+}
+
+void Oversampler::reset ()
+{
+  for (size_t i = 0; i < m_up.size (); ++i)
+  {
+    m_up[i].reset ();
+    m_down[i].reset ();
+  }
+
+  m_filter.reset ();
+}
+
+void Oversampler::prepare (int numChannels)
+{
+  if (m_up.size () != size_t (numChannels * maxStages))
+  {
+    m_up.resize (numChannels * maxStages);
+    m_down.resize (numChannels * maxStages);
+    m_buffer.resize (2 * numChannels * m_factor * blockSize);
+    m_channels.resize (std::max (numChannels, 1));
+  }
+}
+
+void Oversampler::process (int numSamples, float* const* arrayOfChannels)
+{
+  processBlock (numSamples, arrayOfChannels);
+}
+
+void Oversampler::process (int numSamples, double* const* arrayOfChannels)
+{
+  processBlock (numSamples, arrayOfChannels);
+}
+
+}
@@ -0,0 +1,291 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_OVERSAMPLER_H
+#define DSPFILTERS_OVERSAMPLER_H
+
+namespace Dsp {
+
+/*
+ * Polyphase IIR halfband filter, for changing the sample rate by two.
+ *
+ * The filter is the sum of two branches of first order allpass
+ * sections in z^-2, one of them delayed by a sample:
+ *
+ *   H(z) = ( A0(z^2) + z^-1 A1(z^2) ) / 2
+ *
+ *   A(z^2) = product of (a + z^-2) / (1 + a z^-2)
+ *
+ * Coefficients alternate between the branches. At the lower rate each
+ * section is first order and takes one multiply, so a filter with n
+ * coefficients costs n multiplies per low rate sample whether it is
+ * interpolating or decimating. The magnitude response is elliptic and
+ * the phase is not linear.
+ *
+ * The transition band is centred on a quarter of the higher rate. Its
+ * half width is normalized to the lower rate: with a transition of 0.02
+ * the passband ends at 0.48 and the stopband starts at 0.52 of the
+ * lower rate.
+ *
+ */
+class Halfband
+{
+public:
+  enum
+  {
+    maxCoefficients = 32
+  };
+
+  // Memory of one channel
+  struct State
+  {
+    State ();
+
+    void reset ();
+
+    double m_x[maxCoefficients];
+    double m_y[maxCoefficients];
+  };
+
+  Halfband ();
+
+  // Design with the fewest coefficients reaching the stopband
+  // attenuation, in dB.
+  void setup (double attenuationDb, double transition);
+
+  // Design with exactly this many coefficients.
+  void setupCoefficients (int numCoefficients, double transition);
+
+  int getNumCoefficients () const
+  {
+    return m_numCoefficients;
+  }
+
+  double getCoefficient (int index) const
+  {
+    return m_coefficients[index];
+  }
+
+  // Response at the higher rate
+  complex_t response (double normalizedFrequency) const;
+
+  // Writes two samples for each input sample
+  template <typename Sample>
+  void upsample (int numSamples,
+                 double* dest,
+                 const Sample* src,
+                 State& state) const
+  {
+    for (int i = 0; i < numSamples; ++i)
+    {
+      double even = src[i];
+      double odd = src[i];
+      processPair (even, odd, state);
+      dest[2 * i] = even;
+      dest[2 * i + 1] = odd;
+    }
+  }
+
+  // Writes one sample for each pair of input samples
+  template <typename Sample>
+  void downsample (int numSamples,
+                   Sample* dest,
+                   const double* src,
+                   State& state) const
+  {
+    for (int i = 0; i < numSamples; ++i)
+    {
+      double even = src[2 * i + 1];
+      double odd = src[2 * i];
+      processPair (even, odd, state);
+      dest[i] = static_cast<Sample> (0.5 * (even + odd));
+    }
+  }
+
+  // Sections needed for the stopband attenuation
+  static int getNumCoefficients (double attenuationDb, double transition);
+
+private:
+  void processPair (double& even, double& odd, State& state) const
+  {
+    const double* a = m_coefficients;
+    double* x = state.m_x;
+    double* y = state.m_y;
+
+    int j = 0;
+    for (; j + 1 < m_numCoefficients; j += 2)
+    {
+      const double e = (even - y[j]) * a[j] + x[j];
+      const double o = (odd - y[j + 1]) * a[j + 1] + x[j + 1];
+      x[j] = even;
+      x[j + 1] = odd;
+      y[j] = e;
+      y[j + 1] = o;
+      even = e;
+      odd = o;
+    }
+
+    if (j < m_numCoefficients)
+    {
+      const double e = (even - y[j]) * a[j] + x[j];
+      x[j] = even;
+      y[j] = e;
+      even = e;
+    }
+  }
+
+private:
+  int m_numCoefficients;
+  double m_coefficients[maxCoefficients];
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * Runs a filter at 2, 4 or 8 times the sample rate of the signal.
+ *
+ * Filters designed close to Nyquist are warped by the bilinear
+ * transform. Running them at a higher rate moves the band of interest
+ * away from Nyquist, where the warping is slight. Each doubling is a
+ * Halfband interpolating on the way up and another decimating on the
+ * way down. Stages after the first have a wider transition band to
+ * work with, because only the low end of their input is occupied, and
+ * need fewer coefficients.
+ *
+ * The filter is not owned, and must be set up for the higher rate:
+ * give it a sample rate of getFactor() times that of the signal. It is
+ * always run in double precision.
+ *
+ */
+class Oversampler
+{
+public:
+  enum
+  {
+    maxStages = 3,
+
+    // Input samples handled at a time
+    blockSize = 256
+  };
+
+  // The defaults keep aliases below -96dB, with a passband up to 0.48
+  // of the signal's sample rate.
+  Oversampler (Filter& filter,
+               int factor,
+               double attenuationDb = 96,
+               double transition = 0.02);
+
+  int getFactor () const
+  {
+    return m_factor;
+  }
+
+  const Halfband& getStage (int index) const
+  {
+    return m_stages[index];
+  }
+
+  // Multiplies per input sample spent in the halfbands, per channel
+  int getNumMultiplies () const;
+
+  // Clears the halfbands and resets the filter.
+  void reset ();
+
+  void process (int numSamples, float* const* arrayOfChannels);
+  void process (int numSamples, double* const* arrayOfChannels);
+
+private:
+  void prepare (int numChannels);
+
+  template <typename Sample>
+  void processBlock (int numSamples, Sample* const* arrayOfChannels)
+  {
+    ScopedFlushDenormals flush;
+
+    const int numChannels = m_filter.getNumChannels ();
+    prepare (numChannels);
+
+    double** channels = &m_channels[0];
+
+    for (int offset = 0; offset < numSamples; offset += blockSize)
+    {
+      const int n = std::min (int (blockSize), numSamples - offset);
+
+      for (int i = 0; i < numChannels; ++i)
+      {
+        double* buffer[2] = { &m_buffer[2 * i * m_factor * blockSize], 0 };
+        buffer[1] = buffer[0] + m_factor * blockSize;
+
+        Halfband::State* up = &m_up[i * maxStages];
+        m_stages[0].upsample (n, buffer[0], arrayOfChannels[i] + offset, up[0]);
+        for (int j = 1; j < m_numStages; ++j)
+          m_stages[j].upsample (n << j, buffer[j & 1], buffer[(j - 1) & 1], up[j]);
+
+        channels[i] = buffer[(m_numStages - 1) & 1];
+      }
+
+      m_filter.process (n * m_factor, channels);
+
+      for (int i = 0; i < numChannels; ++i)
+      {
+        double* buffer[2] = { &m_buffer[2 * i * m_factor * blockSize], 0 };
+        buffer[1] = buffer[0] + m_factor * blockSize;
+
+        Halfband::State* down = &m_down[i * maxStages];
+        for (int j = m_numStages; --j >= 1;)
+          m_stages[j].downsample (n << j, buffer[(j - 1) & 1], buffer[j & 1], down[j]);
+        m_stages[0].downsample (n, arrayOfChannels[i] + offset, buffer[0], down[0]);
+      }
+    }
+  }
+
+private:
+  Oversampler (const Oversampler&);
+  Oversampler& operator= (const Oversampler&);
+
+private:
+  Filter& m_filter;
+  int m_factor;
+  int m_numStages;
+  Halfband m_stages[maxStages];
+  std::vector<Halfband::State> m_up;
+  std::vector<Halfband::State> m_down;
+  std::vector<double> m_buffer;
+  std::vector<double*> m_channels;
+};
+
+}
+
+#endif
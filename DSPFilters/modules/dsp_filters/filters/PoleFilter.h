@@ -75,6 +75,20 @@ public:
   }
 #endif
 
+protected:
+  // Restores the digital layout and stages of a design from the
+  // process-wide cache. Returns false if the design has to be
+  // made, after which it should be stored with storeDesign.
+  bool findDesign (const DesignKey& key)
+  {
+    return DesignCache::findCascade (key, m_digitalProto, *this);
+  }
+
+  void storeDesign (const DesignKey& key)
+  {
+    DesignCache::storeCascade (key, m_digitalProto, *this);
+  }
+
 protected:
   LayoutBase m_digitalProto;
 };
@@ -105,6 +119,15 @@ template <class BaseClass,
 struct PoleFilter : BaseClass
                   , CascadeStages <(MaxDigitalPoles + 1) / 2>
 {
+  // What a SizedFilter needs to provide the storage instead
+  typedef BaseClass base_t;
+
+  enum
+  {
+    maxOrder = MaxAnalogPoles,
+    digitalPolesPerOrder = MaxDigitalPoles / MaxAnalogPoles
+  };
+
   PoleFilter ()
   {
     // This glues together the factored base classes
@@ -0,0 +1,1467 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+namespace Dsp {
+
+/*
+ * These tables were computed by finding the roots of the prototype
+ * polynomials with 50 digit arithmetic, then rounding to double.
+ * The Bessel poles are the roots of the reverse Bessel polynomial,
+ * the Legendre poles are the left half plane roots of 1 + L(-s^2),
+ * where L is the "Optimum-L" polynomial.
+ *
+ */
+
+namespace Bessel {
+
+static const double analogPoleValues[] =
+{
+  // order 1
+  -1.0, 0,
+  // order 2
+  -1.5, 0.8660254037844386,
+  // order 3
+  -1.8389073226869572, 1.7543809597837217,
+  -2.3221853546260856, 0,
+  // order 4
+  -2.1037893971796278, 2.6574180418567526,
+  -2.8962106028203722, 0.8672341289345038,
+  // order 5
+  -2.324674303181645, 3.571022920337976,
+  -3.3519563991535333, 1.7426614161831977,
+  -3.6467385953296434, 0,
+  // order 6
+  -2.5159322478108215, 4.492672953653942,
+  -3.735708356325815, 2.6262723114471256,
+  -4.248359395863364, 0.8675096732313656,
+  // order 7
+  -2.6856768789432657, 5.420694130716749,
+  -4.070139163638138, 3.5171740477097533,
+  -4.758290528154629, 1.7392860611305365,
+  -4.971786858527936, 0,
+  // order 8
+  -2.8389839488976305, 6.353911298604877,
+  -4.368289217202403, 4.414442500471539,
+  -5.204840790636882, 2.6161751526425276,
+  -5.587886043263085, 0.8676144453527864,
+  // order 9
+  -2.9792607981800714, 7.291463688342182,
+  -4.6384398871803905, 5.317271675435651,
+  -5.604421819507781, 3.4981569178860936,
+  -6.129367904274273, 1.7378483834808625,
+  -6.297019181714968, 0,
+  // order 10
+  -3.108916233649098, 8.232699459073588,
+  -4.886219566858999, 6.224985482471567,
+  -5.967528328587786, 4.384947188941932,
+  -6.61529096547687, 2.61156792080009,
+  -6.922044905427246, 0.8676651954512214,
+  // order 11
+  -3.229722089920306, 9.177111568708579,
+  -5.115648283908279, 7.1370207588933665,
+  -6.301337454871309, 5.276191743696768,
+  -7.057892387669953, 3.4890145035558295,
+  -7.484229860731939, 1.7371028207534038,
+  -7.6223398457964295, 0,
+  // order 12
+  -3.3430233078025333, 10.12429680724082,
+  -5.329708590875829, 8.052906864257032,
+  -6.611004249956352, 6.17153499303723,
+  -7.46557124035177, 4.370169593354565,
+  -7.997270599601435, 2.6090665369457984,
+  -8.25342201141208, 0.8676935720097688,
+  // order 13
+  -3.449867220628723, 11.073928552216197,
+  -5.530680983344037, 8.972247775155788,
+  -6.9003728261466595, 7.0706443121529485,
+  -7.844380277062596, 5.2549034066119615,
+  -8.470591771477185, 3.483868450660993,
+  -8.830252084144904, 1.7366664003076306,
+  -8.947709674391792, 0,
+  // order 14
+  -3.551086883380626, 12.025738032254525,
+  -5.720352383827519, 9.894707597489159,
+  -7.172395962171818, 7.9732173541849685,
+  -8.198846969988475, 6.143041071470797,
+  -8.911000555375045, 4.361604178302447,
+  -9.363145851609552, 2.6075533243816666,
+  -9.583171393646966, 0.8677110288642532,
+  // order 15
+  -3.6473568624883024, 12.979501070760419,
+  -5.9001517136646475, 10.819999137753573,
+  -7.429396992942154, 8.878982621121516,
+  -8.532459052298341, 7.034393625517046,
+  -9.32359932060897, 5.242258895237617,
+  -9.85956722839628, 3.4806712114327665,
+  -10.170913996440069, 1.736388919450456,
+  -10.273109666322478, 0,
+  // order 16
+  -3.7392317971608726, 13.935028475813382,
+  -6.0712413829087, 11.747874938480889,
+  -7.67324079086716, 9.787697438369069,
+  -8.847968196502785, 7.928772855889371,
+  -9.712326332563503, 6.125760891021767,
+  -10.325119602341463, 4.356163380609608,
+  -10.718985818978014, 2.6065670072582896,
+  -10.911886078677503, 0.8677225274357204,
+  // order 17
+  -3.827173785099387, 14.892158924664288,
+  -6.234580978360413, 12.678120229066504,
+  -7.905449595937342, 10.699145075465168,
+  -9.147588677603155, 8.825998301493334,
+  -10.080294444857781, 7.012009982693768,
+  -10.764134177562843, 5.234074902036876,
+  -11.233436817269544, 3.478543890764697,
+  -11.50807677713976, 1.7362015379080633,
+  -11.59852949233955, 0,
+  // order 18
+  -3.9115722911554083, 15.850753596937734,
+  -6.390972783683975, 13.610547349091433,
+  -8.127283945095625, 11.613131751195994,
+  -9.433132220808712, 9.725900314128458,
+  -10.430012965302145, 7.900893103313035,
+  -11.180039016537041, 6.114394093036996,
+  -11.71894879565529, 4.352479754299835,
+  -12.068135844936773, 2.6058878817334543,
+  -12.23990213682503, 0.8677305005306094,
+  // order 19
+  -3.992758917882353, 16.810692060111624,
+  -6.541095062161414, 14.544991303021211,
+  -8.339800719136736, 12.529483823944624,
+  -9.70610240075825, 10.628321100246287,
+  -10.763538440003279, 8.792293021673027,
+  -11.575601065403184, 6.997076374701257,
+  -12.179231260382938, 5.228450548390898,
+  -12.597062809664761, 3.477054900106677,
+  -12.842827796895222, 1.7360690509027332,
+  -12.923963055423728, 0,
+  // order 20
+  -4.0710185618163175, 17.771869068885454,
+  -6.68552687829519, 15.481306187923618,
+  -8.543895726850032, 13.4480452734197,
+  -9.967762478860392, 11.533114728516246,
+  -11.082580333731151, 9.686093241828578,
+  -11.953090802499988, 7.88205843424745,
+  -12.617281316609851, 6.106479870052397,
+  -13.098822474577164, 4.349864911791462,
+  -13.412597143606602, 2.6054001471794974,
+  -13.567424283153313, 0.8677362549557983,
+  // order 21
+  -4.146597974503759, 18.73419204282762,
+  -6.824766934092511, 16.41936229928728,
+  -8.74033556438962, 14.368675493561163,
+  -10.219185263216106, 12.440146622437654,
+  -11.388577061608505, 10.582180716542792,
+  -12.314397739182898, 8.769266832204881,
+  -13.035560639093356, 6.986558406340086,
+  -13.576620861274955, 5.224408900399568,
+  -13.953409203515717, 3.4759711131772244,
+  -14.175845496671846, 1.7359719206233315,
+  -14.249406524901454, 0,
+  // order 22
+  -4.219712425593164, 19.697579055111127,
+  -6.959248085375502, 17.359043767554404,
+  -8.929781865088762, 15.291247379702948,
+  -10.46129048000098, 13.349292816358346,
+  -11.682751935116007, 11.48044728408325,
+  -12.66111358579682, 9.658623316126825,
+  -13.436119716133678, 7.868656136768012,
+  -14.0330932781634, 6.100731104115524,
+  -14.468661837243712, 4.347939381757682,
+  -14.75364243859861, 2.6050379512520454,
+  -14.894584352889364, 0.8677405436434433,
+  // order 23
+  -4.290550955054995, 20.661957211655718,
+  -7.0893486838986295, 18.300246613328696,
+  -9.112810040970425, 16.215645679351905,
+  -10.694873269930538, 14.260439124918053,
+  -11.966155142125356, 12.380790350209562,
+  -12.994593495537776, 10.550048126963166,
+  -13.820687374248486, 8.752730166278614,
+  -14.470436457836215, 6.9788447232341255,
+  -14.961149894475325, 5.221402104136749,
+  -15.304390656735237, 3.4751572561932176,
+  -15.50757534265125, 1.7358985923766166,
+  -15.57485737307154, 0,
+  // order 24
+  -4.359280561047162, 21.627261332209937,
+  -7.215401549600733, 19.24287713550726,
+  -9.289923965580577, 17.14176557277716,
+  -10.920626250431331, 15.173480305977877,
+  -12.239695793076095, 13.283113122256205,
+  -13.316002054892769, 11.44346205442253,
+  -14.19073674699039, 9.63872984156538,
+  -14.890503832962505, 7.85874220895792,
+  -15.433204545102056, 6.096415282125166,
+  -15.831032889792576, 4.346479201960045,
+  -16.092120722518167, 2.6047615575773193,
+  -16.22147108800564, 0.8677438252331852,
+  // order 25
+  -4.426049574071369, 22.59343286760654,
+  -7.337701147885492, 20.18685056621114,
+  -9.461567618464834, 18.069511451082214,
+  -11.13915682949026, 16.088319258367743,
+  -12.504166758630724, 14.18732457932364,
+  -13.626348417459317, 12.33878769890522,
+  -14.547534843182055, 10.526600135362813,
+  -15.294875784329093, 8.74040214324919,
+  -15.886793808159393, 6.973006458545242,
+  -16.336025000097457, 5.219102091196987,
+  -16.65130125438597, 3.474530310240777,
+  -16.838322031500798, 1.7358418756062886,
+  -16.900313864686478, 0,
+  // order 26
+  -4.490990401462246, 23.560419003669598,
+  -7.456509389562515, 21.13208994112721,
+  -9.628134422440024, 18.998795862730347,
+  -11.351000959426662, 17.004866274173914,
+  -12.760264182855959, 15.093339290493935,
+  -13.926513554772184, 13.235950223589033,
+  -14.892180435451069, 11.416283902872495,
+  -15.684912452357395, 9.62379391713945,
+  -16.32359671535052, 7.851183322205059,
+  -16.821441334549238, 6.093088204123184,
+  -17.187689257784353, 4.3453449277564875,
+  -17.428620477062694, 2.6045458167870628,
+  -17.548146416925146, 0.8677463920510533,
+  // order 27
+  -4.554221779206844, 24.528171914043416,
+  -7.572060361335164, 22.078525145018528,
+  -9.789974806129697, 19.92953860328095,
+  -11.55663418320199, 17.923038353249215,
+  -13.008603000753387, 16.00107714976623,
+  -14.217271680973424, 14.134877776029397,
+  -15.225633463778625, 12.307723390644801,
+  -16.06179412430674, 10.508880954911236,
+  -16.745059094257915, 8.730939651916472,
+  -17.289052496979462, 6.968474094116635,
+  -17.703458439852273, 5.217302036320342,
+  -17.99504810849421, 3.474036970154843,
+  -18.168301076229575, 1.735797104657721,
+  -18.225774769001397, 0,
+  // order 28
+  -4.6158506343566, 25.49664813288572,
+  -7.684564216875836, 23.02609210064938,
+  -9.947402385254499, 20.861665926767788,
+  -11.75648059501711, 18.84275858101626,
+  -13.249729414328652, 16.910463070029742,
+  -14.499307302772564, 15.035501694671002,
+  -15.548738164978337, 13.200861242692289,
+  -16.42655259114463, 11.395622959048692,
+  -17.152436247387254, 9.612259486926117,
+  -17.74038387485548, 7.845277772827335,
+  -18.200465012281636, 6.090466763945367,
+  -18.53987200169058, 4.344445905256883,
+  -18.763562687402057, 2.6043741739785475,
+  -18.87465487165477, 0.8677484375654343,
+  // order 29
+  -4.675973636764674, 26.465808024821726,
+  -7.794210402485255, 23.974732075886177,
+  -10.10069905736155, 21.795109860464333,
+  -11.950920175273914, 19.76395556712638,
+  -13.484131023535955, 17.821426662060624,
+  -14.773228937458489, 15.937756575568981,
+  -15.862241489011021, 14.095641164442155,
+  -16.780095824174847, 12.283977484675132,
+  -17.546826102060795, 10.495120091232334,
+  -18.17676043702606, 8.723503808629863,
+  -18.68030876514278, 6.964881143726596,
+  -19.06502885500853, 5.215866017014523,
+  -19.33628646236306, 3.4736417088853284,
+  -19.497669237900794, 1.7357611445876084,
+  -19.55123918886455, 0,
+  // order 30
+  -4.734678500817707, 27.435615334413757,
+  -7.901170350431137, 24.924391088773156,
+  -10.250119233382616, 22.72980760766166,
+  -12.140294844903732, 20.686562940810976,
+  -13.712245127751398, 18.733901914305537,
+  -15.039580260306613, 16.84158024901045,
+  -16.166807924012385, 14.99200835169135,
+  -17.123227631372565, 13.173901048247332,
+  -17.929195308005305, 11.379494083168494,
+  -18.5993415429785, 9.60314699638868,
+  -19.14437983466589, 7.84057012382393,
+  -19.572188438419968, 6.088363124646,
+  -19.888485119606504, 4.343721058479196,
+  -20.097256587201617, 2.604235366675683,
+  -20.201029296144068, 0.8677500939526555,
+  // order 31
+  -4.792045084371223, 28.406036801094643,
+  -8.005599742836091, 25.875019394305124,
+  -10.395893377266828, 23.66570102553715,
+  -12.324913500937278, 21.610518898052064,
+  -13.934465584744583, 19.647826882767138,
+  -15.298849245443547, 17.746913699109523,
+  -16.463031549464077, 15.88990975711685,
+  -17.456663486989985, 14.06534990876532,
+  -18.30040003297982, 12.265350978325644,
+  -19.00914835658291, 10.484195031301882,
+  -19.59389505739974, 8.717545930406537,
+  -20.062802201362445, 6.961982377403179,
+  -20.421894556630587, 5.214701583984136,
+  -20.675501712001257, 3.4733200942391598,
+  -20.82654328355328, 1.7357318255916068,
+  -20.87670645487269, 0,
+  // order 32
+  -4.848146321958926, 29.37704182834897,
+  -8.107640426389112, 26.826571039697345,
+  -10.538230986318453, 24.602736167256275,
+  -12.505056234321682, 22.535765795559797,
+  -14.151148521100797, 20.563143396224863,
+  -15.551475723668105, 18.65370094851427,
+  -16.751445924831202, 16.78929424408151,
+  -17.7810434065519, 14.958280616330962,
+  -18.661202715553323, 13.152658314566036,
+  -19.407085697674532, 11.366630477381413,
+  -20.029926610628422, 9.595811276356006,
+  -20.538141071870182, 7.836753299251937,
+  -20.938024182775198, 6.086648444573263,
+  -21.23420323772268, 4.343127984199332,
+  -21.42993449349873, 2.6041215149460037,
+  -21.527294445136757, 0.8677514540044025,
+  // order 33
+  -4.90304902163135, 30.348602198122702,
+  -8.20742204108216, 27.77900347738307,
+  -10.677323115943802, 25.540862879175585,
+  -12.680977885861454, 23.46224978671473,
+  -14.362617119892592, 21.479796779443166,
+  -15.797857679082618, 19.561888923082893,
+  -17.032532269807678, 17.69011266220404,
+  -18.096942513835952, 15.852650394017326,
+  -19.012285695400877, 14.04138247580357,
+  -19.793959650891114, 12.250432229268508,
+  -20.4534248489742, 10.475361747923191,
+  -20.999325245684428, 8.712693523874645,
+  -21.438196074860944, 6.95960831263849,
+  -21.774925577742714, 5.213744010040763,
+  -22.01306124641104, 3.4730548686351623,
+  -22.155011984187617, 1.7357076071033037,
+  -22.20217605741891, 0,
+  // order 34
+  -4.956814548853542, 31.320691823157258,
+  -8.30506341314477, 28.732277226901374,
+  -10.81334453061157, 26.480034445453608,
+  -12.85291106231577, 24.389920494958986,
+  -14.5691656608382, 22.397735595397236,
+  -16.03835653188398, 20.47142730648995,
+  -17.306726282951093, 18.592317868794073,
+  -18.404879785628317, 16.7484173995006,
+  -19.354262403721172, 14.931489296406326,
+  -20.170491896604155, 13.135576605524882,
+  -20.865236712351617, 11.356187597436028,
+  -21.44734794619852, 9.589811592922251,
+  -21.92357584601574, 7.83361362692663,
+  -22.299039366426236, 6.085231836511579,
+  -22.57754032530757, 4.342636477955912,
+  -22.76177435683633, 2.6040269705420656,
+  -22.853469330311416, 0.8677525844152932,
+  // order 35
+  -5.009499416299863, 32.2932865312946,
+  -8.400673752315152, 29.686355578383544,
+  -10.946455546086746, 27.420207273573777,
+  -13.021068709032072, 25.318730720514154,
+  -14.771062950241028, 23.31691140654237,
+  -16.27330159936906, 21.382268391403393,
+  -17.57442386530382, 19.49586471312753,
+  -18.705325343686038, 17.64554089952668,
+  -19.687686626779158, 15.822944504404068,
+  -20.537331479785557, 14.022038170876257,
+  -21.266120711294683, 12.23827510129656,
+  -21.883094582135246, 10.468109074433228,
+  -22.39519727447089, 8.708685796239166,
+  -22.807753345977552, 6.957638582838913,
+  -23.124788614937707, 5.21294684168652,
+  -23.349248345885066, 3.47283355736546,
+  -23.483144035551124, 1.7356873708126124,
+  -23.52764760169849, 0,
+  // order 36
+  -5.0611557947968535, 33.26636387687072,
+  -8.494353685790978, 30.641204331589968,
+  -11.076803615078209, 28.361340615280852,
+  -13.185646315860414, 26.248636176713923,
+  -14.968555249226679, 24.23727855454829,
+  -16.502993885697276, 22.29436693160877,
+  -17.835985956068924, 20.40070999558589,
+  -18.998706577994888, 18.543981380986565,
+  -20.013060232810727, 16.715714045346843,
+  -20.895064554966332, 14.909790357120858,
+  -21.656759236330778, 13.12160759611202,
+  -22.30735834726315, 11.347582181375689,
+  -22.853982167393237, 9.5848376388169,
+  -23.302139815371515, 7.830998425914581,
+  -23.656055951029128, 6.084047631275877,
+  -23.91889501278566, 4.342224541771906,
+  -24.092914806955317, 2.6039475986344978,
+  -24.179568794579936, 0.8677535341197484,
+  // order 37
+  -5.111831957841068, 34.239902975170054,
+  -8.586196155098406, 31.596791565456112,
+  -11.204524698385223, 29.30339631826346,
+  -13.346823817924898, 27.179595252638187,
+  -15.161868786751697, 25.158793957573057,
+  -16.72770931945634, 23.20767999790536,
+  -18.091742642706333, 21.306812410208344,
+  -19.28541332203647, 19.44370061583523,
+  -20.330839662456366, 17.609764317231438,
+  -21.244222516776816, 15.798805933169602,
+  -22.037768752923977, 14.006166274021819,
+  -22.72085303753418, 12.228223018269857,
+  -23.30075653976631, 10.46207525768149,
+  -23.783155161420428, 8.705335356124975,
+  -24.17245134541143, 6.955985687583714,
+  -24.47200345880363, 5.212276018039093,
+  -24.684285003793246, 3.472646959321889,
+  -24.810993432359968, 1.7356702889919196,
+  -24.853120777106422, 0,
+  // order 38
+  -5.16157266987939, 35.213884356600246,
+  -8.676287197300733, 32.55308743392529,
+  -11.32974445574004, 30.246338604609882,
+  -13.504767241011114, 28.111568799107893,
+  -15.351211926819753, 26.081416923970995,
+  -16.94770153394261, 24.12216683953431,
+  -18.34199667388704, 22.214132476747526,
+  -19.565802253174375, 20.344661692438766,
+  -20.64144141598555, 18.505062338816007,
+  -21.585288831126967, 16.689057361157865,
+  -22.40970830938522, 14.891930796175382,
+  -23.124223668955487, 13.110020548124847,
+  -23.736263910520396, 11.340399494734752,
+  -24.251656585389146, 9.580665305986177,
+  -24.674964149215416, 7.828796088719156,
+  -25.00971778642843, 6.083047384829527,
+  -25.258581337844696, 4.341875840580455,
+  -25.42346545798518, 2.603880315669508,
+  -25.50560459540846, 0.8677543396793155,
+  // order 39
+  -5.210419526751488, 36.18828983780246,
+  -8.764706628140116, 33.51006398451611,
+  -11.452579284309303, 31.19013387264511,
+  -13.659630132047644, 29.044519935440128,
+  -15.536777046057438, 27.00510898125494,
+  -17.163204266404026, 25.037788752168385,
+  -18.587026477738686, 23.12263246656671,
+  -19.840200655131138, 21.246829022596224,
+  -20.94524672030553, 19.401575867842226,
+  -21.918704811920133, 17.580517065940136,
+  -22.77308668667556, 15.778879767723893,
+  -23.518055340315577, 13.992961347006965,
+  -24.161176319608735, 12.219807066838802,
+  -24.70841585248003, 10.456997808944491,
+  -25.164481298887818, 8.702504528579635,
+  -25.533058862813395, 6.9545847205975,
+  -25.81698153466674, 5.211706092162268,
+  -26.018347684773975, 3.472488166269895,
+  -26.13860320300861, 1.7356557383616142,
+  -26.17859533592811, 0,
+  // order 40
+  -5.25841125525747, 37.16310240736418,
+  -8.85152864164325, 34.4676949966232,
+  -11.573137227854435, 32.134750519244974,
+  -13.811554807816435, 29.978413874668615,
+  -15.718742167362795, 27.929833719126016,
+  -17.37443343793758, 25.954508952993518,
+  -18.82708876770089, 24.0322763254598,
+  -20.10890965182259, 22.150168331063778,
+  -21.24260552057829, 20.29927348148466,
+  -22.244874535461577, 18.47315763834524,
+  -23.128368445838312, 16.6669911065512,
+  -23.90288068265708, 14.87703019593391,
+  -24.576103525815594, 13.100291459428808,
+  -25.154130687006383, 11.334337302361448,
+  -25.641801495936832, 9.577129177709796,
+  -26.042942059445277, 7.8269234086760715,
+  -26.360536668135055, 6.082194704348332,
+  -26.596850124144982, 4.341578035031599,
+  -26.753514130598745, 2.6038227839794237,
+  -26.83158616698643, 0.8677550288554998,
+  // order 41
+  -5.305583977652501, 38.138306124170946,
+  -8.93682233825639, 35.42595583700506,
+  -11.691518775574863, 33.08015878013319,
+  -13.960673449175584, 30.91321776520689,
+  -15.897272387074363, 28.855556645417657,
+  -17.581588964288944, 26.87229246307393,
+  -19.06242080261603, 24.94302959556927,
+  -20.372207000381195, 23.054646632642978,
+  -21.533839912000275, 21.19812462827736,
+  -22.564169044672422, 19.366951987523148,
+  -23.47597907377456, 17.556242329919044,
+  -24.27918616138086, 15.76221054716525,
+  -24.981600739350057, 13.9818436335931,
+  -25.58943428775479, 12.21268415833621,
+  -26.107646961208843, 10.452682151091544,
+  -26.540191841171676, 8.700090197610129,
+  -26.89018937023302, 6.953386676211441,
+  -27.160052864516484, 5.211217735304478,
+  -27.35157844951529, 3.4723519089803854,
+  -27.466008060307043, 1.735643242341907,
+  -27.50407107818961, 0,
+  // order 42
+  -5.351971445925941, 39.11388602673713,
+  -9.020652191578332, 36.38482333029032,
+  -11.80781756645203, 34.02633058601327,
+  -14.107109063384838, 31.84890054717187,
+  -16.072521126518314, 29.782245053858183,
+  -17.784856338737423, 27.791105996965882,
+  -19.293242355340322, 25.85485933792191,
+  -20.630349514473725, 23.96023220059587,
+  -21.819247104649786, 22.09809965850462,
+  -22.87692996450143, 20.26187345400492,
+  -23.81630938627608, 18.44661077732028,
+  -24.64741743970985, 16.648484892809154,
+  -25.378175164640698, 14.864452588469769,
+  -26.01490332902771, 13.092035504446578,
+  -26.562673252051052, 11.32917067447861,
+  -27.02555386233562, 9.574104831725041,
+  -27.406788810178828, 7.825317272849124,
+  -27.708924729596234, 6.081461807572151,
+  -27.93390417036452, 4.341321661177469,
+  -28.083132017163546, 2.603773205162001,
+  -28.157521167093716, 0.8677556230343813,
+  // order 43
+  -5.39760524995079, 40.08982805210672,
+  -9.103078462133736, 37.34427564264844,
+  -11.92212101231184, 34.97323943268014,
+  -14.250976333336258, 32.78543282179719,
+  -16.244631233501675, 30.7098679026263,
+  -17.98440802101853, 28.71091785939677,
+  -19.519757434382125, 26.767734056626566,
+  -20.88357517586213, 24.866894529188517,
+  -22.09910199662947, 22.99916983836075,
+  -23.183472626150973, 21.1578958923458,
+  -24.149719315162052, 19.338073783493474,
+  -25.007983968806958, 17.535835056960593,
+  -25.766291569593008, 15.74810581057523,
+  -26.43106473175474, 13.972385880969167,
+  -27.00747751863297, 12.20659801740471,
+  -27.499705071445067, 10.448981351356839,
+  -27.91110311665006, 8.69801381673269,
+  -28.24433862997774, 6.952353970990782,
+  -28.501485329878214, 5.210796048058518,
+  -28.68409296397617, 3.472234111255758,
+  -28.793236318502622, 1.7356324314798877,
+  -28.829547840685724, 0,
+  // order 44
+  -5.4425150029549645, 41.06611896312344,
+  -9.18415756529752, 38.3042921770343,
+  -12.034510850702556, 35.92086026350434,
+  -14.392382369417174, 33.72278673255147,
+  -16.41373595504772, 31.638395702749538,
+  -18.180404660430455, 29.63169784873243,
+  -19.742155795272737, 27.68162362543295,
+  -21.132104981730556, 25.77460429244894,
+  -22.373659416824047, 23.90130735192459,
+  -23.484088779173494, 22.05499373016351,
+  -24.476541181539865, 20.230608812319485,
+  -25.36126293651203, 18.42424242762333,
+  -26.146377052607647, 16.63278963416371,
+  -26.8384014280355, 14.853727769840427,
+  -27.442605492283477, 13.084964244067166,
+  -27.963262210835396, 11.324729136817126,
+  -28.403829756895373, 9.57149712025663,
+  -28.767084296958114, 7.823929073519028,
+  -29.055217698707875, 6.080827180001151,
+  -29.269909249293516, 4.34109936086704,
+  -29.412377443044765, 2.6037301773180057,
+  -29.483415876435217, 0.8677561389061719,
+  // order 45
+  -5.486728507242364, 42.0427462830428,
+  -9.263942399385293, 39.264853478637214,
+  -12.145063636946338, 36.869169362893516,
+  -14.531427377222025, 34.66093585673938,
+  -16.579959799198985, 32.56780041547212,
+  -18.37299617657955, 30.553417166899962,
+  -19.96061427210862, 28.596499217099726,
+  -21.376144566980415, 26.68333330069046,
+  -22.643156087570464, 24.8044852940455,
+  -23.77904895589045, 22.95314200883249,
+  -24.797082537826707, 21.124193559892134,
+  -25.70760268085427, 19.313688140960412,
+  -26.518825144145143, 17.518489531139906,
+  -27.23735729607656, 15.736052022304662,
+  -27.868557435914678, 13.964266820943065,
+  -28.41678901218936, 12.201353751862133,
+  -28.885604268831514, 10.445782639397127,
+  -29.2778789240795, 8.696214655222386,
+  -29.595911813448783, 6.951457377165076,
+  -29.84149869271787, 5.210429392762849,
+  -30.015986367180027, 3.4721315795210757,
+  -30.120311303160612, 1.7356230157953443,
+  -30.155025488900947, 0,
+  // order 46
+  -5.5302719026572635, 43.019698236604334,
+  -9.342482639018542, 40.22594114935183,
+  -12.253851183289754, 37.81814425951567,
+  -14.668205252269182, 35.599855106505665,
+  -16.74341930087829, 33.49805535779334,
+  -18.562322717407348, 31.47604833540377,
+  -20.175297954639447, 29.512333235838586,
+  -21.6158856340112, 27.593054455949538,
+  -22.907812348739036, 25.70867765651803,
+  -24.06860454100851, 23.852316409917087,
+  -25.11162864591381, 22.01880603321618,
+  -26.047325654341417, 20.20415322762359,
+  -26.883999352891855, 18.405190344870356,
+  -27.62834140686083, 16.619348206013246,
+  -28.28579323885175, 14.844501110894079,
+  -28.86080232433609, 13.078857629065451,
+  -29.357007654577416, 11.32088140873939,
+  -29.777376121634187, 9.569232210383566,
+  -30.124303869514016, 7.822720861981036,
+  -30.399691902728662, 6.080273945841137,
+  -30.60500220926575, 4.340905342562181,
+  -30.74129865028411, 2.603692594536375,
+  -30.809275494881533, 0.8677565896503358,
+  // order 47
+  -5.5731697999236145, 43.996963696804066,
+  -9.419824998120507, 41.1875377702461,
+  -12.360940951892324, 38.76776363822334,
+  -14.802804111179444, 36.53952063828732,
+  -16.904223704469768, 34.429135115448304,
+  -18.748515511025406, 32.3995651170615,
+  -20.38636123215916, 30.42909925297016,
+  -21.851507217101027, 28.503741707184627,
+  -23.167833677654524, 26.61385930937405,
+  -24.3529895900651, 24.75249327052669,
+  -25.42044464675975, 22.914424609582746,
+  -26.38073100916215, 21.09561872878913,
+  -27.24223624570207, 19.29287647908374,
+  -28.011731696288788, 17.503604887700046,
+  -28.69473680171636, 15.725660776738254,
+  -29.295777360723903, 13.957240629621714,
+  -29.81857267786908, 12.196800803760167,
+  -30.266173499786508, 10.44299821308844,
+  -30.641064888783692, 8.694645128475056,
+  -30.94524341059834, 6.950673879217163,
+  -31.180274971647734, 5.210108570659938,
+  -31.347337638017674, 3.472041782804877,
+  -31.44725240386763, 1.7356147651118732,
+  -31.480503910970896, 0,
+  // order 48
+  -5.6154454006880075, 44.97453213671073,
+  -9.496013466270592, 42.14962683113582,
+  -12.466396407405373, 39.71800725975008,
+  -14.935306767364423, 37.47990976986799,
+  -17.062475573860297, 35.36101546266944,
+  -18.931697625324418, 33.32394244308734,
+  -20.59394872209123, 31.346771945833794,
+  -22.08317680410696, 29.415370005853706,
+  -23.423412033570397, 27.520005978700656,
+  -24.632422432907962, 25.653649590083774,
+  -25.72377746704176, 23.811028080594976,
+  -26.708096860856635, 21.9880657879024,
+  -27.593848134052386, 20.181532050646712,
+  -28.387878154968515, 18.38880986404599,
+  -29.095779828593884, 16.607738112172093,
+  -29.7221522163014, 14.836500502745043,
+  -30.270789257567973, 13.073545165623264,
+  -30.744819128476255, 11.317524955602543,
+  -31.14680848452938, 9.567252057424128,
+  -31.47884104259135, 7.821662647515945,
+  -31.742576906045073, 6.079788713852769,
+  -31.939297032976466, 4.34073499685555,
+  -32.069935888022194, 2.6036595749129394,
+  -32.135104364387075, 0.8677569857858886,
+  // order 49
+  -5.657120605840582, 45.952393585756106,
+  -9.571089521618893, 43.11219266648967,
+  -12.570277334069232, 40.66885588736431,
+  -15.065791158100625, 38.42100090428417,
+  -17.21827133908813, 36.29367328812825,
+  -19.11198464721002, 34.24915634515944,
+  -20.798196098393117, 32.265327039927136,
+  -22.311051334612575, 30.327915262315347,
+  -23.67472705076097, 28.42709422206905,
+  -24.907107092407653, 26.555763030460806,
+  -26.021857500731898, 24.708595683983425,
+  -27.029682277963055, 22.881475722880793,
+  -27.939125426705605, 21.071141013157195,
+  -28.757105610851443, 19.27495035066508,
+  -29.489285121507606, 17.490724314062312,
+  -30.140331774350578, 15.716633264282354,
+  -30.714109110880138, 13.951116315807603,
+  -31.213817070897132, 12.192821237484237,
+  -31.64209747722217, 10.440558830026683,
+  -32.001113859466805, 8.693267504608327,
+  -32.29261208229901, 6.949985147999606,
+  -32.51796623610438, 5.209826231950917,
+  -32.6782128912837, 3.4719626942060247,
+  -32.77407587108106, 1.7356074948424023,
+  -32.80598301310725, 0,
+  // order 50
+  -5.698216113473592, 46.93053859000452,
+  -9.645092323119771, 44.07522039698654,
+  -12.672640121565465, 41.620291219764184,
+  -15.194330728884703, 39.36277345991707,
+  -17.37170178741817, 37.227086526513446,
+  -19.289485291564137, 35.175183892122334,
+  -20.99923083262016, 33.18474125420529,
+  -22.535278090696817, 31.241354303367082,
+  -23.92194710049464, 29.335101402409517,
+  -25.17723454371649, 27.458811911025936,
+  -26.314900097187504, 25.607107125702957,
+  -27.345729037071425, 23.77583008255235,
+  -28.278338697867028, 21.96168725687121,
+  -29.11971616644021, 20.16201313708239,
+  -29.875589454731774, 18.3746097071725,
+  -30.550691100999074, 16.597633509951088,
+  -31.148949769980494, 14.829513981902402,
+  -31.673632147862207, 13.068892934878484,
+  -32.127449562380036, 11.314578680678123,
+  -32.512638922081415, 9.565510491780252,
+  -32.831024495726496, 7.820730466099233,
+  -33.08406504050588, 6.079360745792818,
+  -33.27288943148705, 4.340584617894494,
+  -33.398323003205014, 2.6036304082032538,
+  -33.46090613892045, 0.8677573357907793
+};
+
+const PoleTable analogPoles = { 50, analogPoleValues };
+
+}
+
+namespace Legendre {
+
+static const double analogPoleValues[] =
+{
+  // order 1
+  -1.0, 0,
+  // order 2
+  -0.7071067811865476, 0.7071067811865476,
+  // order 3
+  -0.345185619031197, 0.9008656355183781,
+  -0.6203318171301238, 0,
+  // order 4
+  -0.23168872267885143, 0.9455106639026735,
+  -0.5497434238454814, 0.35857181622501044,
+  // order 5
+  -0.1535867376030384, 0.9681464077834296,
+  -0.3881398517848867, 0.5886323380681557,
+  -0.4680898755846017, 0,
+  // order 6
+  -0.1151926790262214, 0.9779222344714283,
+  -0.3089608853059938, 0.6981674628144449,
+  -0.4389015495598766, 0.23998135208805685,
+  // order 7
+  -0.08620854829124476, 0.9843698067113431,
+  -0.23743975723791763, 0.7783008922405689,
+  -0.3492317848724585, 0.4289961167174899,
+  -0.3821033150999626, 0,
+  // order 8
+  -0.06894215761926317, 0.9879709680602969,
+  -0.19427588132916143, 0.8247667245411431,
+  -0.30028400490128065, 0.5410422453911328,
+  -0.36717631012214225, 0.18087919953768955,
+  // order 9
+  -0.055097156647131426, 0.9906603253417129,
+  -0.1572837690261001, 0.8613428506215113,
+  -0.2485528956868289, 0.6338196199860864,
+  -0.3093854331060566, 0.33654323712733547,
+  -0.32568782235818566, 0,
+  // order 10
+  -0.04590098260620834, 0.9923831856678583,
+  -0.13251878245234017, 0.8852617692859948,
+  -0.21417299146122798, 0.6945377067420224,
+  -0.2774054135391581, 0.43964616384408195,
+  -0.3172064579284383, 0.14543025128196443,
+  // order 11
+  -0.03822929494328287, 0.9937618388264341,
+  -0.11117119560254383, 0.9049913774907828,
+  -0.1820061367546249, 0.7459291157919822,
+  -0.2397116104861334, 0.5309398058091866,
+  -0.27629975271160745, 0.2767427360671405,
+  -0.2853625542881842, 0,
+  // order 12
+  -0.032761159570974814, 0.9947229974416658,
+  -0.09588326823947481, 0.9189206090626103,
+  -0.15891973683435437, 0.7822122338010199,
+  -0.2134684462261912, 0.5951703878030289,
+  -0.2541921714697648, 0.3697783705829768,
+  -0.2802774739121573, 0.12175493710869778,
+  // order 13
+  -0.028071444001624105, 0.9955259406295908,
+  -0.08252377744945241, 0.9307803356084127,
+  -0.13787621212687173, 0.8135621379816016,
+  -0.18728571268320013, 0.6520963586092934,
+  -0.2257829000180219, 0.45564551041379786,
+  -0.24944983091447992, 0.2349882706705942,
+  -0.25488098972289175, 0,
+  // order 14
+  -0.024558867531577926, 0.9961187241702611,
+  -0.072487413798894, 0.9396083671210529,
+  -0.12202255856243031, 0.8368975990362179,
+  -0.16767313354460317, 0.694386322392546,
+  -0.20560625245312514, 0.519040630715586,
+  -0.23345907477340563, 0.3189420764338146,
+  -0.251769984505245, 0.104795980337469,
+  // order 15
+  -0.021484270217860875, 0.9966285471752478,
+  -0.06359846072528283, 0.9472977400336441,
+  -0.1076256641742921, 0.8574106795918738,
+  -0.14900530158852138, 0.7321362116870583,
+  -0.18443458670069043, 0.5770317665863253,
+  -0.2113203699544774, 0.39861171541519763,
+  -0.2274843451909388, 0.20420284685668127,
+  -0.23091120734845644, 0,
+  // order 16
+  -0.01909506342234857, 0.9970208169092382,
+  -0.056677034355219084, 0.9532477544009045,
+  -0.09638918906755324, 0.8732834046817155,
+  -0.1344427103587291, 0.7613164854108253,
+  -0.1681526157861967, 0.621705075728305,
+  -0.19552997306439562, 0.4594875351791451,
+  -0.21550080666789365, 0.28036151625607547,
+  -0.22902785737609055, 0.09203546268846124,
+  // order 17
+  -0.01697082946548886, 0.997365313718169,
+  -0.05047440772393379, 0.9585196039829532,
+  -0.0861551480790921, 0.8874334690375582,
+  -0.12079870578622591, 0.7875908196803553,
+  -0.15210657575916467, 0.6625517837829275,
+  -0.1782498608301817, 0.5164631811951442,
+  -0.19774531991498825, 0.354073535437337,
+  -0.2092568439550375, 0.1805696314799203,
+  -0.21149766977996295, 0,
+  // order 18
+  -0.015272514144862671, 0.9976387965693853,
+  -0.04550836641494402, 0.9627217416320503,
+  -0.07794650974136927, 0.8987122308742358,
+  -0.10984656017820521, 0.8085215038696699,
+  -0.13928205021657622, 0.6950318139951145,
+  -0.16475173636318888, 0.5615599809656395,
+  -0.18515166324865526, 0.41186506483354685,
+  -0.2000218061861011, 0.2501044908161808,
+  -0.21041593856374324, 0.08207750969193536,
+  // order 19
+  -0.013743784017502885, 0.9978827794116832,
+  -0.04101324160398173, 0.9664947443473261,
+  -0.07043294053853981, 0.9088828268271295,
+  -0.09963364971604076, 0.8275259507930616,
+  -0.12695258624462757, 0.7248272311740533,
+  -0.1510579206499418, 0.6035559890465394,
+  -0.17085548323592176, 0.4668930943615368,
+  -0.18543511238372626, 0.31839473864077267,
+  -0.19390913023678502, 0.16185523186917333,
+  -0.19541000687994026, 0,
+  // order 20
+  -0.012493580089441552, 0.9980812714245232,
+  -0.03733328167616624, 0.9695734906733594,
+  -0.06427328231168923, 0.9171819127649447,
+  -0.09125257797056036, 0.8430279308083263,
+  -0.1168466537077174, 0.7491062515448798,
+  -0.1399273607074712, 0.6376902553958208,
+  -0.15959566318227295, 0.5113712574356913,
+  -0.1752132694115345, 0.3730164071884789,
+  -0.1866313232525648, 0.22574788825159353,
+  -0.1948710022685459, 0.07408512511909922,
+  // order 21
+  -0.011356898828337772, 0.9982605364889768,
+  -0.03397380263744739, 0.9723673860249554,
+  -0.058604720609245486, 0.9247368250873391,
+  -0.08343896983048589, 0.8572098918956046,
+  -0.10723292638830714, 0.7714792474683745,
+  -0.12899081379137314, 0.6694692662130672,
+  -0.14788369203997492, 0.5533896977768747,
+  -0.16321903386522021, 0.425725005771668,
+  -0.17440510113632648, 0.2892003957348823,
+  -0.18081214934172404, 0.14666759671354704,
+  -0.18183195115439652, 0,
+  // order 22
+  -0.01040999182695412, 0.9984092827149135,
+  -0.031173018250596835, 0.9746909248384212,
+  -0.05387370063179993, 0.9310198255444578,
+  -0.0769113481333976, 0.8690015892607109,
+  -0.09920206051771402, 0.7900697639231828,
+  -0.11988532433502361, 0.6958367725011138,
+  -0.1382537153115891, 0.5881435218448003,
+  -0.15374364856673442, 0.46904506948746383,
+  -0.16597798144340442, 0.34077018297093675,
+  -0.17497184627414275, 0.2057220210113028,
+  -0.18167054027762627, 0.06752547998068142,
+  // order 23
+  -0.009541918358551697, 0.9985449473960059,
+  -0.028597496002387736, 0.9768179267660254,
+  -0.04949706769338083, 0.9367849769292573,
+  -0.0708152807172755, 0.8798613858255541,
+  -0.09159499199472208, 0.8072822191757023,
+  -0.11107371641245718, 0.7204298648941886,
+  -0.12861180614393514, 0.6208880831170902,
+  -0.14366721567880908, 0.5104425798709176,
+  -0.15578141958536718, 0.3910644963008844,
+  -0.16455023535620267, 0.26488439390021484,
+  -0.16950220622265505, 0.13409450522308675,
+  -0.1701988186669901, 0,
+  // order 24
+  -0.008807590225229962, 0.9986593583474116,
+  -0.026417477504295017, 0.9786148816234547,
+  -0.04578932888908066, 0.9416555310441811,
+  -0.0656464782934199, 0.8890346389851725,
+  -0.08514289484986118, 0.8218157163461076,
+  -0.10360974196517198, 0.7411764907590805,
+  -0.12048980613020002, 0.6484596761127849,
+  -0.13531920607613365, 0.5451723732151785,
+  -0.14773278245613305, 0.43296524642379935,
+  -0.15750707772783798, 0.3136003178076443,
+  -0.16474522646203502, 0.1889670657445651,
+  -0.17030554155250233, 0.06204299333676839,
+  // order 25
+  -0.008129703722495206, 0.9987645518485887,
+  -0.024400222207823122, 0.980271829962549,
+  -0.04234263756234363, 0.9461547989204558,
+  -0.06080718489836754, 0.897532579850457,
+  -0.07903884335511523, 0.8353335208858396,
+  -0.0964410224165562, 0.7605790275529919,
+  -0.11251176302742417, 0.674434821811226,
+  -0.12682087821578023, 0.5782170567995257,
+  -0.13900006914915233, 0.4733839732677603,
+  -0.14873403228479062, 0.36152187212595843,
+  -0.1557345369124228, 0.24432578965632218,
+  -0.15963280236410943, 0.12351340231976286,
+  -0.16010648880025966, 0,
+  // order 26
+  -0.007548779843404461, 0.9988544802779771,
+  -0.02267069057435148, 0.9816903172323421,
+  -0.039385514537008844, 0.9500065396303207,
+  -0.0566522279822773, 0.90480673298554,
+  -0.07379556042455285, 0.8469015202240219,
+  -0.09028582411712795, 0.7771732413313884,
+  -0.10567959998442555, 0.6966243367938288,
+  -0.11959992209312838, 0.6063830230618439,
+  -0.131732416838393, 0.5076936215292299,
+  -0.1418347122710803, 0.40189770139753755,
+  -0.14977726796490315, 0.2904094593976811,
+  -0.15571014484619122, 0.17474228468555125,
+  -0.16040649250489086, 0.05739114031416756,
+  // order 27
+  -0.0070093223471030764, 0.9989377223408008,
+  -0.02106159067333909, 0.9830063548009469,
+  -0.03662438806595173, 0.9535852289276622,
+  -0.05275116253273325, 0.9115801959629353,
+  -0.0688335551487768, 0.8577069553846689,
+  -0.0843956311781055, 0.7927386603010548,
+  -0.09903715443944712, 0.7175532536001907,
+  -0.11241264205344687, 0.6331421935965287,
+  -0.12422261936556811, 0.5406068434703207,
+  -0.1342088047182343, 0.441149862614473,
+  -0.14214716179345527, 0.3360645374780007,
+  -0.147824166264414, 0.22672026243480117,
+  -0.1509409175978523, 0.11448492969512788,
+  -0.15125751306508026, 0,
+  // order 28
+  -0.006541870924084579, 0.9990097127032342,
+  -0.019666743289609198, 0.9841457895403151,
+  -0.03422956889746699, 0.9566836763313245,
+  -0.049365537010562226, 0.9174442374228257,
+  -0.06452509027216184, 0.8670598817092128,
+  -0.079281341022105, 0.8062064133555269,
+  -0.09327689324291122, 0.7356478118674318,
+  -0.10620464949371343, 0.6562446571661149,
+  -0.1178013516504312, 0.5689502483333659,
+  -0.12784840739231842, 0.47480026216963395,
+  -0.13618221027772923, 0.3748970939149396,
+  -0.14273234447266767, 0.27039119822747526,
+  -0.14767281222249082, 0.1625146358190876,
+  -0.15169828194208607, 0.05339353310755749,
+  // order 29
+  -0.006105564713402634, 0.9990767322449304,
+  -0.018362862633540745, 0.9852085222084478,
+  -0.03198448517586408, 0.9595768838304974,
+  -0.0461776850395035, 0.9229295370644996,
+  -0.06044319162431455, 0.875830415390536,
+  -0.07439467743210487, 0.8188771680769186,
+  -0.08770821318208488, 0.7527443518670428,
+  -0.10010311323814307, 0.6781932064408078,
+  -0.1113337792127146, 0.5960708328805311,
+  -0.12118583509912999, 0.5073049943933116,
+  -0.12947319725178608, 0.412896966507583,
+  -0.136032004837998, 0.31391368130981523,
+  -0.1406986276801796, 0.2114765279099981,
+  -0.1432237574429839, 0.10669016696608039,
+  -0.14342771941464663, 0,
+  // order 30
+  -0.005723848836960927, 0.9991352730357915,
+  -0.017221771485931354, 0.9861376617629811,
+  -0.030018798410034735, 0.962106389448731,
+  -0.043385089522604205, 0.9277250052774444,
+  -0.056865757386040654, 0.8834969408238037,
+  -0.07011124011075048, 0.8299499303768788,
+  -0.08282968647279451, 0.7676769385384342,
+  -0.09476903192478611, 0.6973456275282013,
+  -0.10570991561331787, 0.6196975548505606,
+  -0.11546386638853247, 0.535542494558775,
+  -0.1238757479369737, 0.44574927525804436,
+  -0.13083400019555586, 0.3512330223639104,
+  -0.13630630087640083, 0.2529410228741611,
+  -0.14047741296791053, 0.1518908740639404,
+  -0.1439716160974005, 0.049920581467370516,
+  // order 31
+  -0.005365978067803759, 0.9991900399684761,
+  -0.016150642443485377, 0.9870082318783093,
+  -0.028169316963526928, 0.9644786732828188,
+  -0.04074830522824718, 0.9322288704676538,
+  -0.05347127441870963, 0.8907116838177164,
+  -0.0660197366669347, 0.8403976710290678,
+  -0.07812786884462262, 0.7818143059964026,
+  -0.08956503823445872, 0.7155559735762612,
+  -0.10012815726588475, 0.6422847757416241,
+  -0.10963811419846486, 0.5627275380954457,
+  -0.11793779875308602, 0.4776710044764298,
+  -0.1248899438701725, 0.38795625955284097,
+  -0.13037154904209922, 0.29447299733939625,
+  -0.1342533834802062, 0.19815059862506,
+  -0.13632264202989886, 0.09989200658595464,
+  -0.13644471399343128, 0,
+  // order 32
+  -0.005050245222965319, 0.9992382947485303,
+  -0.015205395133876273, 0.9877758694816041,
+  -0.026536569251019756, 0.966570464929213,
+  -0.038419476507903824, 0.9362000326467131,
+  -0.05047198015342329, 0.8970724625574149,
+  -0.06240369602208855, 0.8496069665430401,
+  -0.07397328285740978, 0.7942713021234847,
+  -0.08497193704796917, 0.731591434800731,
+  -0.09521637065744219, 0.6621524065560194,
+  -0.10454611332532154, 0.5865952886796725,
+  -0.11282348102706098, 0.5056116927992229,
+  -0.11993655512200636, 0.4199360400900574,
+  -0.12580903206176008, 0.3303351564975869,
+  -0.1304335624041827, 0.23759756267624588,
+  -0.1339980006276116, 0.14257459972029604,
+  -0.1370642785374041, 0.04687490509287263,
+  // order 33
+  -0.004753076599917209, 0.9992836318538018,
+  -0.014314818483466229, 0.9884980081416609,
+  -0.024995293758732957, 0.9685398012796842,
+  -0.03621476496184176, 0.9399431400294318,
+  -0.047621192026884175, 0.9030777830850614,
+  -0.058948356862310106, 0.8583202900850977,
+  -0.06997532705094114, 0.8060895927751347,
+  -0.08051052967723682, 0.7468567753889634,
+  -0.09038461411422163, 0.6811468097499322,
+  -0.09944705286024015, 0.6095369861526969,
+  -0.10756441736613286, 0.5326537309353551,
+  -0.1146191970155493, 0.4511686114994181,
+  -0.12050798945479885, 0.3657940837329967,
+  -0.1251362646034068, 0.2772793133026533,
+  -0.1283991935428452, 0.18640282164555497,
+  -0.1301117087266294, 0.09391049407702926,
+  -0.13017358702075893, 0,
+  // order 34
+  -0.0044889514590409655, 0.9993238834267208,
+  -0.013523101634651785, 0.9891395515672607,
+  -0.02362467197424709, 0.9702893448377354,
+  -0.03425341711517805, 0.9432683709566503,
+  -0.04508412695312941, 0.9084122792817941,
+  -0.05587244301955396, 0.8660591726068676,
+  -0.06641642985064032, 0.816583425606698,
+  -0.07654145721841636, 0.7604051213173593,
+  -0.08609349448181605, 0.6979918246626498,
+  -0.09493614721147803, 0.629857081073663,
+  -0.10294973110079547, 0.5565570577048577,
+  -0.11003195835904457, 0.47868572301193707,
+  -0.11610104032570268, 0.3968683986710946,
+  -0.12110506426780733, 0.3117532052750918,
+  -0.12505324615766708, 0.22400296829036756,
+  -0.12813205391597002, 0.13433820120484963,
+  -0.13084848181732883, 0.04418189055493061,
+  // order 35
+  -0.004239494130316738, 0.9993618431306787,
+  -0.01277471400433186, 0.9897452113096366,
+  -0.022326982577926664, 0.9719421021623725,
+  -0.03239198569864128, 0.9464127421857315,
+  -0.04266839115201175, 0.9134634946955149,
+  -0.05293090396676629, 0.8734000846185511,
+  -0.0629937512321869, 0.8265598894278426,
+  -0.07269616109140159, 0.7733212890780865,
+  -0.0818957275314072, 0.714105907704347,
+  -0.09046517122978773, 0.6493779624628858,
+  -0.09829070020284827, 0.5796421961842028,
+  -0.10527108891119626, 0.5054410469728858,
+  -0.11131685175955763, 0.4273514501748557,
+  -0.11634861115411657, 0.3459816249681974,
+  -0.12029213473413383, 0.26196801996657926,
+  -0.12306035554498455, 0.1759690494010658,
+  -0.12448987437441314, 0.08860658000417101,
+  -0.12450714066411732, 0,
+  // order 36
+  -0.004016313083362223, 0.9993957728754148,
+  -0.012105037654326816, 0.9902868627381938,
+  -0.021165462824003306, 0.9734201883661574,
+  -0.03072533366676827, 0.9492247221640431,
+  -0.04050471069664793, 0.9179804876863106,
+  -0.0502955691369652, 0.8799638997601782,
+  -0.05992709635898494, 0.8354785172320722,
+  -0.06925186452436229, 0.784864052045735,
+  -0.0781395316668194, 0.7284986154997163,
+  -0.0864738604776566, 0.6667981518984297,
+  -0.094151449587005, 0.6002143740215827,
+  -0.10108157480788717, 0.5292316536332412,
+  -0.1071871625660345, 0.45436291299662385,
+  -0.1124078567208151, 0.3761442371345879,
+  -0.11670892266588577, 0.2951277678793836,
+  -0.12011063083426936, 0.21187563284028677,
+  -0.12279547636847517, 0.12700400611252066,
+  -0.12522211157489635, 0.04178339135833237,
+  // order 37
+  -0.003804874260635079, 0.999427876919419,
+  -0.01147013794859484, 0.9907998320071354,
+  -0.020062772434123695, 0.9748207719071611,
+  -0.029139915133905153, 0.9518914686199135,
+  -0.03844084876503724, 0.9222690797276285,
+  -0.047772788343961814, 0.8862050523696764,
+  -0.05697785528831477, 0.8439744939224011,
+  -0.06591981969305198, 0.7958849953315983,
+  -0.0744779483858785, 0.7422791231657833,
+  -0.0825439345202581, 0.6835343583981883,
+  -0.09002031231526123, 0.6200617926646986,
+  -0.0968196081386747, 0.5523041397478365,
+  -0.10286379018571448, 0.48073336371191483,
+  -0.10808360978190035, 0.4058481572950058,
+  -0.11241707487064574, 0.32817152318659804,
+  -0.11580472534708647, 0.24824853309098027,
+  -0.1181727306392133, 0.1666408299109266,
+  -0.1193750298299678, 0.08387111706957107,
+  -0.11935904479690307, 0,
+  // order 38
+  -0.0036145920905554197, 0.9994567457786752,
+  -0.010898680072622926, 0.9912613196778468,
+  -0.019070038231036417, 0.976080791597913,
+  -0.027712185578102247, 0.954290522933816,
+  -0.03658170933236976, 0.9261270028957083,
+  -0.04549966204649997, 0.8918189886406781,
+  -0.054320104656959696, 0.8516155251009976,
+  -0.06291745262302285, 0.8057944407698227,
+  -0.07118060447139131, 0.7546648163696213,
+  -0.07901004898633587, 0.6985669937777159,
+  -0.08631647590802526, 0.6378713287363668,
+  -0.09302027134653276, 0.5729761383561639,
+  -0.09905170433325958, 0.504304976739883,
+  -0.10435200339877787, 0.4323031598326248,
+  -0.10887632756192417, 0.3574332315139478,
+  -0.11260222525803022, 0.2801689972838413,
+  -0.11555733886409403, 0.200991038613048,
+  -0.11791874628648552, 0.12043130249124004,
+  -0.12010252867890159, 0.03963341340590201,
+  // order 39
+  -0.003433821013695846, 0.9994841420574857,
+  -0.010355452643665556, 0.9916996056143973,
+  -0.018125260520963516, 0.977278020984345,
+  -0.02635111167408276, 0.9565716341953138,
+  -0.034805272158483835, 0.9297988152530225,
+  -0.04332112867624587, 0.897168792511194,
+  -0.05176320022437332, 0.8589084347873,
+  -0.060015010143002576, 0.8152705178009848,
+  -0.06797338945738589, 0.7665363110685369,
+  -0.07554558118828508, 0.7130158931928394,
+  -0.08264771087089935, 0.6550473715798121,
+  -0.08920396288831701, 0.5929954964147761,
+  -0.09514610801980947, 0.5272499155907029,
+  -0.10041313192968812, 0.45822323431586254,
+  -0.104950661158814, 0.38634903895002487,
+  -0.10870951008160745, 0.3120800809969602,
+  -0.11164117215327064, 0.23588662623933537,
+  -0.11368189569264438, 0.1582515016330897,
+  -0.1146997845819858, 0.07961722803786583,
+  -0.11465894050034273, 0,
+  // order 40
+  -0.0032702756405811636, 0.9995089109143135,
+  -0.009863925666212775, 0.9920960139089277,
+  -0.017270230048967328, 0.9783608557319708,
+  -0.025119028268672926, 0.9586347475106649,
+  -0.03319676547644026, 0.9331196062387372,
+  -0.041348057550649686, 0.9020068469084507,
+  -0.04944706847591386, 0.8655029761165001,
+  -0.05738591248590698, 0.8238375501981202,
+  -0.06506919997080217, 0.7772657193447786,
+  -0.07241127878372187, 0.7260685921244189,
+  -0.07933482348221771, 0.6705525189746708,
+  -0.08577018352274424, 0.6110477218877954,
+  -0.0916552415456589, 0.5479064316779999,
+  -0.09693575637886638, 0.48150054680970594,
+  -0.10156646177329283, 0.4122186893489098,
+  -0.10551392229942341, 0.34046235426359134,
+  -0.10876458185768435, 0.2666408483858922,
+  -0.1113509539108716, 0.19116806340189585,
+  -0.1134439522289203, 0.11450720502796222,
+  -0.11542209470119484, 0.03769509150888465,
+  // order 41
+  -0.003114515913875784, 0.9995324786996621,
+  -0.009395550967399368, 0.9924734510591102,
+  -0.01645467008200611, 0.9793922818768072,
+  -0.02394210938162799, 0.9606011018245344,
+  -0.03165725520547044, 0.9362872772594492,
+  -0.03945482010066499, 0.9066267503227928,
+  -0.04721750884153938, 0.8718085290587798,
+  -0.054844898490363864, 0.8320424022750945,
+  -0.062248164332274876, 0.7875615274768649,
+  -0.06934735897607616, 0.7386229828577991,
+  -0.0760699455337892, 0.6855073467094919,
+  -0.08234999194957351, 0.6285177418238896,
+  -0.08812771971905532, 0.5679785564411863,
+  -0.0933492188338998, 0.5042339675616179,
+  -0.09796616587607687, 0.43764636952004454,
+  -0.10193529646197957, 0.36859482891932827,
+  -0.10521701076164706, 0.2974737252791806,
+  -0.10777106399305304, 0.22469152970558331,
+  -0.10954153297662143, 0.150666244167799,
+  -0.11040830349250018, 0.07577489826280222,
+  -0.11034887051992254, 0,
+  // order 42
+  -0.0029729232005636748, 0.9995538903134984,
+  -0.008969729229155276, 0.9928164739106544,
+  -0.01571307805564954, 0.980329663015537,
+  -0.022871703244885036, 0.962388136637963,
+  -0.030256744754092735, 0.9391659927140961,
+  -0.037732133579839906, 0.9108250098126606,
+  -0.045188452802399415, 0.8775380888880174,
+  -0.05253228558546965, 0.8394966818345352,
+  -0.05968115489725634, 0.7969133246346399,
+  -0.0665609163216361, 0.7500222196559367,
+  -0.07310437307112597, 0.6990788706497785,
+  -0.07925056566088494, 0.6443591676850323,
+  -0.08494448192658144, 0.5861580870465085,
+  -0.09013709317236278, 0.5247880574117442,
+  -0.09478576523078315, 0.4605769583889408,
+  -0.09885534354403422, 0.3938656122142268,
+  -0.1023208916203069, 0.32500448097845297,
+  -0.10517536371265869, 0.25434933276284666,
+  -0.10745442310742945, 0.18225902603548863,
+  -0.10932250130876345, 0.10914010094141112,
+  -0.11112488422400686, 0.035938527139168765,
+  // order 43
+  -0.002837764848345344, 0.9995743124270541,
+  -0.00856307226327337, 0.9931438336118519,
+  -0.015004258620017454, 0.9812245516457875,
+  -0.021847316066182943, 0.9640950554196488,
+  -0.028914181363857643, 0.94191761586184,
+  -0.036077137607235646, 0.9148416074267139,
+  -0.043233809261841595, 0.883025967290369,
+  -0.050296941222780396, 0.8466463824601933,
+  -0.05718951325044736, 0.8058978231147452,
+  -0.06384218916863822, 0.7609952391078938,
+  -0.07019191794265102, 0.7121733869382338,
+  -0.07618114889365385, 0.659686182411669,
+  -0.08175738748980522, 0.6038057656123617,
+  -0.08687293459415334, 0.5448213818328009,
+  -0.0914846979291898, 0.48303815174794934,
+  -0.09555395674882353, 0.4187758037923515,
+  -0.09904586271739241, 0.35236746738731123,
+  -0.10192809644069344, 0.28415866034625953,
+  -0.1041667431888549, 0.214506381229347,
+  -0.10571207277456816, 0.14377483525989115,
+  -0.1064539241806831, 0.0722870713265939,
+  -0.1063806330601101, 0,
+  // order 44
+  -0.002714364731320044, 0.9995929483648633,
+  -0.008191756634544588, 0.993442650048927,
+  -0.014356943423382798, 0.9820414122759807,
+  -0.020911639337914314, 0.9656531222092384,
+  -0.027687626654996318, 0.9444292239747866,
+  -0.03456483637598569, 0.9185076996256502,
+  -0.04144739402285317, 0.8880346008069767,
+  -0.04825381355717912, 0.853170972258975,
+  -0.05491230218906096, 0.8140953238631071,
+  -0.06135830808271591, 0.7710043425352123,
+  -0.06753318409898894, 0.724112762874622,
+  -0.07338346219620906, 0.673652763535124,
+  -0.07886049466009137, 0.6198730484846124,
+  -0.08392034897883952, 0.5630376775846412,
+  -0.08852393216456919, 0.5034246520648419,
+  -0.09263742726100672, 0.44132420128181765,
+  -0.09623334952030102, 0.3770366295416198,
+  -0.09929317188257708, 0.3108694555319981,
+  -0.10181465372239332, 0.24313366938150885,
+  -0.1038354106636099, 0.17414233881604507,
+  -0.1055133370323395, 0.1042548643460169,
+  -0.10716423076660377, 0.03433921386103367,
+  // order 45
+  -0.0025963285665432864, 0.9996107616688257,
+  -0.00783643989019483, 0.9937284201626986,
+  -0.013737059401349911, 0.9828228448540445,
+  -0.020014636687927273, 0.9671442923835334,
+  -0.026510049925358967, 0.9468344873788938,
+  -0.03311020602617774, 0.9220213604859496,
+  -0.039725087764241926, 0.8928397046762152,
+  -0.04627833526174214, 0.8594378672477254,
+  -0.05270271548875002, 0.8219801967184845,
+  -0.0589377337937671, 0.7806478227391095,
+  -0.06492830537123662, 0.735638653330762,
+  -0.07062399571349007, 0.6871669492045134,
+  -0.07597858229162023, 0.6354626426617822,
+  -0.08094979947463983, 0.5807704903577955,
+  -0.08549917872050347, 0.5233491170189408,
+  -0.08959191112914686, 0.4634699982456558,
+  -0.09319663738149225, 0.40141643905952545,
+  -0.09628496840327934, 0.33748263228869124,
+  -0.0988301885629393, 0.2719729102067376,
+  -0.1008033041281741, 0.2052010664794437,
+  -0.1021595676644196, 0.13748629473460103,
+  -0.10279734019923911, 0.0691067818628687,
+  -0.1027137903205966, 0,
+  // order 46
+  -0.0024881328425570767, 0.9996270825991258,
+  -0.007510717416915183, 0.9939903168494189,
+  -0.013168730623186582, 0.9835389956042406,
+  -0.019192100919869517, 0.96851087296391,
+  -0.02543003218752827, 0.9490387440227305,
+  -0.03177583764050357, 0.9252412788251422,
+  -0.03814491511061888, 0.8972428553846256,
+  -0.0444656977130394, 0.8651800102518098,
+  -0.050675293902852185, 0.8292038214284886,
+  -0.0567171863989652, 0.7894806926655995,
+  -0.06253995534242218, 0.7461923830138906,
+  -0.06809655977336943, 0.6995356201773768,
+  -0.07334394873475981, 0.6497214476472112,
+  -0.07824288700160939, 0.5969743729080186,
+  -0.08275794693637847, 0.5415313386972778,
+  -0.08685767584637905, 0.4836405027388171,
+  -0.0905150371210228, 0.4235597646846077,
+  -0.09370843181217753, 0.36155490247152633,
+  -0.09642421804408677, 0.2978970715724756,
+  -0.09866372441159767, 0.23285954778213,
+  -0.10046567897929994, 0.16671700770633194,
+  -0.10198154377691061, 0.09978930663279692,
+  -0.10350086870000376, 0.03287687196175004,
+  // order 47
+  -0.002384444296587575, 0.9996427139506938,
+  -0.007198454761253965, 0.9942412592714762,
+  -0.012623532742746723, 0.9842253739290998,
+  -0.018402290288574142, 0.9698211628117499,
+  -0.0243916624236082, 0.9511533528797491,
+  -0.03049084082985098, 0.9283323885162201,
+  -0.03662013654868503, 0.9014734834376552,
+  -0.04271227885323614, 0.8707028535658133,
+  -0.04870820816942929, 0.8361600605011407,
+  -0.054554840487356086, 0.7979988342330245,
+  -0.060203809367880674, 0.7563871869752161,
+  -0.06561073506578012, 0.7115071475211652,
+  -0.0707347943551565, 0.6635542681667015,
+  -0.07553846681256382, 0.6127369832514182,
+  -0.07998738234157049, 0.559275866718089,
+  -0.08405021631000828, 0.5034028237940746,
+  -0.08769857978391392, 0.4453602517748186,
+  -0.09090682398584113, 0.3854002168115769,
+  -0.09365157651181219, 0.3237837204938198,
+  -0.09591048825231584, 0.26078015361543394,
+  -0.09765844316660174, 0.19666678628126855,
+  -0.09885476594012421, 0.1317248669959385,
+  -0.09940519971637574, 0.06619501769167119,
+  -0.09931414926571148, 0,
+  // order 48
+  -0.0022890540109301123, 0.9996570886409861,
+  -0.006911161119962142, 0.994472080315454,
+  -0.0121218715339494, 0.9848567158785635,
+  -0.017675443315613944, 0.9710263770561914,
+  -0.02343591288506392, 0.9530983537358073,
+  -0.029307885716287986, 0.9311754894042016,
+  -0.0352162224776991, 0.9053644998467953,
+  -0.04109766756147708, 0.8757819855599678,
+  -0.04689679542543277, 0.8425567110956663,
+  -0.052563853564016716, 0.805830424375773,
+  -0.058053549217700964, 0.7657579933113399,
+  -0.06332434978276148, 0.7225071723488445,
+  -0.0683380840537255, 0.6762581389487387,
+  -0.07305973349999616, 0.6272028658812809,
+  -0.07745735804009443, 0.5755443575489907,
+  -0.08150213941778887, 0.521495753089399,
+  -0.08516856826800104, 0.4652792725719941,
+  -0.08843487977814339, 0.40712494281113576,
+  -0.09128403944070444, 0.34726897071858703,
+  -0.0937061638555838, 0.2859515379901859,
+  -0.09570524413207494, 0.22341394755293456,
+  -0.09732052847825122, 0.15989846231788202,
+  -0.0986972460079779, 0.09569150595075028,
+  -0.10010150813593303, 0.03153457322704621,
+  // order 49
+  -0.002197478576636096, 0.9996708809095641,
+  -0.00663527200797041, 0.9946936358361861,
+  -0.011639848685152708, 0.9854628562612234,
+  -0.016976464790208975, 0.9721838882643277,
+  -0.02251578122618476, 0.9549672625239137,
+  -0.02816739788058408, 0.9339090295658132,
+  -0.033860329157161154, 0.9091083799065651,
+  -0.039534945550393885, 0.8806734540655758,
+  -0.04513906069034266, 0.8487235749509748,
+  -0.050625838464265355, 0.813390086398628,
+  -0.05595260404126612, 0.7748165460705456,
+  -0.061080143766721835, 0.7331585757339399,
+  -0.06597228576935048, 0.6885835080296603,
+  -0.07059564790899603, 0.6412699009459323,
+  -0.07491948616265898, 0.5914069610113335,
+  -0.07891559941326798, 0.53919390296262,
+  -0.08255825513188696, 0.48483926974609765,
+  -0.08582409495784626, 0.4285602403649623,
+  -0.08869194819778523, 0.3705819661038165,
+  -0.09114238146377207, 0.3111370010987917,
+  -0.09315648698988509, 0.25046491128643344,
+  -0.09471224320220749, 0.18881188751015593,
+  -0.09577235097028958, 0.12642696816454627,
+  -0.09624901313767309, 0.06351910359248156,
+  -0.09615258826503519, 0,
+  // order 50
+  -0.002112949897009832, 0.9996836074114468,
+  -0.006380595726547367, 0.9948981125678644,
+  -0.011194842320535327, 0.9860222715524507,
+  -0.016331079514281574, 0.9732521623200336,
+  -0.021666073067079517, 0.956692065768706,
+  -0.02711403511205556, 0.9364317379737493,
+  -0.03260783323318961, 0.9125633751442968,
+  -0.03809122736594109, 0.8851872226219913,
+  -0.04351509527044587, 0.854413744603666,
+  -0.0488354108007861, 0.820364453974303,
+  -0.05401209469273165, 0.7831721204601975,
+  -0.05900834011648658, 0.7429806463320884,
+  -0.06379021524288182, 0.6999447399370302,
+  -0.06832643818433011, 0.6542294498559105,
+  -0.07258826819672949, 0.6060095896227521,
+  -0.07654948693656169, 0.5554690632851562,
+  -0.08018646908628861, 0.5028000854143411,
+  -0.08347837687761965, 0.4482022678640467,
+  -0.08640758555979441, 0.39188151014089806,
+  -0.08896063413128534, 0.3340485678808401,
+  -0.0911305547600028, 0.2749170923701618,
+  -0.09292332862894241, 0.2147011159441569,
+  -0.09437830536567846, 0.15361535653001726,
+  -0.09563473354666688, 0.09191777193075003,
+  -0.09693772897293017, 0.0302980748485538
+};
+
+const PoleTable analogPoles = { 50, analogPoleValues };
+
+}
+
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_POLETABLES_H
+#define DSPFILTERS_POLETABLES_H
+
+namespace Dsp {
+
+/*
+ * Poles of analog prototypes, worked out ahead of time
+ *
+ * Some prototypes get their poles from a root finder, which is slow
+ * and loses accuracy as the order goes up. For orders up to maxOrder
+ * the poles are instead looked up in a table computed to full double
+ * precision. For each order the table lists the poles in the upper
+ * half of the s-plane, in the order the designs add them, followed by
+ * the real pole when the order is odd.
+ *
+ */
+struct PoleTable
+{
+  // Returns the real and imaginary parts of the (order + 1) / 2
+  // poles of the given order, or 0 if the order is not in the table.
+  const double* getPoles (int order) const
+  {
+    if (order < 1 || order > maxOrder)
+      return 0;
+
+    // each order before this one has (order + 1) / 2 poles
+    return poles + 2 * ((order * order) / 4);
+  }
+
+  // Replaces the poles of the layout with those of the given order,
+  // with every zero at infinity. Returns false if the order is not
+  // in the table.
+  bool design (LayoutBase& layout, int order) const
+  {
+    const double* pole = getPoles (order);
+    if (!pole)
+      return false;
+
+    layout.reset ();
+
+    const int pairs = order / 2;
+    for (int i = 0; i < pairs; ++i, pole += 2)
+      layout.addPoleZeroConjugatePairs (complex_t (pole[0], pole[1]),
+                                        infinity());
+
+    if (order & 1)
+      layout.add (pole[0], infinity());
+
+    return true;
+  }
+
+  int maxOrder;
+  const double* poles;
+};
+
+}
+
+#endif
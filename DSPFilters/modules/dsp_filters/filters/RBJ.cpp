@@ -45,9 +45,11 @@ void LowPass::setup (double sampleRate,
   double cs = cos (w0);
   double sn = sin (w0);
   double AL = sn / (2 * q);
-  double b0 = (1 - cs) / 2;
-  double b1 =  1 - cs;
-  double b2 = (1 - cs) / 2;
+  // 1 - cs loses its precision near DC, 2 sin^2 (w0/2) does not
+  double sh = sin (w0 / 2);
+  double b0 =  sh * sh;
+  double b1 =  2 * sh * sh;
+  double b2 =  sh * sh;
   double a0 =  1 + AL;
   double a1 = -2 * cs;
   double a2 =  1 - AL;
@@ -62,9 +64,12 @@ void HighPass::setup (double sampleRate,
   double cs = cos (w0);
   double sn = sin (w0);
   double AL = sn / ( 2 * q );
-  double b0 =  (1 + cs) / 2;
-  double b1 = -(1 + cs);
-  double b2 =  (1 + cs) / 2;
+  // and 1 + cs near Nyquist, where cos (w0/2) is found as the sine of
+  // the exact distance to Nyquist
+  double ch = sin (doublePi_2 * (sampleRate - 2 * cutoffFrequency) / sampleRate);
+  double b0 =  ch * ch;
+  double b1 = -2 * ch * ch;
+  double b2 =  ch * ch;
   double a0 =  1 + AL;
   double a1 = -2 * cs;
   double a2 =  1 - AL;
@@ -199,6 +204,353 @@ void AllPass::setup (double sampleRate,
   setCoefficients (a0, a1, a2, b0, b1, b2);
 }
 
+//------------------------------------------------------------------------------
+
+namespace {
+
+// The same formulae as the raw filters, for a vector of them. Each
+// fills c with a0, a1, a2, b0, b1, b2 from the parameters p.
+
+// The angle w0 from the sample rate and frequency in p, with its sine
+// and cosine. They are built from sh = sin (w0/2) and ch = cos (w0/2),
+// each taken as the sine of the distance to DC or to Nyquist so that
+// it keeps its relative precision. Then sn stays precise at both ends
+// of the band, and 1 - cs = 2 sh^2 and 1 + cs = 2 ch^2 are available
+// without cancellation.
+template <class Vector>
+struct Angle
+{
+  explicit Angle (const Vector* p)
+  {
+    const Vector h = Vector (doublePi) * p[1] / p[0];
+    sh = vectorSin (h);
+    ch = vectorSin (Vector (doublePi_2) * (p[0] - Vector (2.) * p[1]) / p[0]);
+    w0 = h + h;
+    sn = Vector (2.) * sh * ch;
+    cs = (ch - sh) * (ch + sh);
+  }
+
+  Vector w0, sn, cs;
+  Vector sh, ch;
+};
+
+struct LowPassDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = a.sh * a.sh;
+    c[4] = two * c[3];
+    c[5] = c[3];
+  }
+};
+
+struct HighPassDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = a.ch * a.ch;
+    c[4] = -(two * c[3]);
+    c[5] = c[3];
+  }
+};
+
+struct BandPass1Design
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = p[2] * AL;
+    c[4] = Vector (0.);
+    c[5] = -c[3];
+  }
+};
+
+struct BandPass2Design
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = AL;
+    c[4] = Vector (0.);
+    c[5] = -AL;
+  }
+};
+
+struct BandStopDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = one;
+    c[4] = c[1];
+    c[5] = one;
+  }
+};
+
+// The two shelves differ only in the signs of b1 and a1
+template <int Sign>
+struct ShelfDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.), sign (Sign * 1.);
+    const Vector A = vectorExp (p[2] * Vector (doubleLn10 / 40));
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / two * vectorSqrt ((A + one / A) * (one / p[3] - one) + two);
+    const Vector sq = two * vectorSqrt (A) * AL;
+    const Vector Ap = A + one;
+    const Vector Am = A - one;
+    c[0] =                  Ap + Am * cs + sq;
+    c[1] = -(two * sign) * (Am + Ap * cs);
+    c[2] =                  Ap + Am * cs - sq;
+    c[3] =    A * (Ap - Am * cs + sq);
+    c[4] = two * sign * A * (Am - Ap * cs);
+    c[5] =    A * (Ap - Am * cs - sq);
+  }
+};
+
+struct BandShelfDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Vector A = vectorExp (p[2] * Vector (doubleLn10 / 40));
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+
+    // sinh (x) = m (m + 2) / (2 (m + 1)) with m = e^x - 1, which keeps
+    // the precision of narrow bands. x passes the range of vectorExpm1
+    // only very close to Nyquist, where those lanes use sinh () instead.
+    const Vector x = Vector (doubleLn2 / 2) * p[3] * a.w0 / sn;
+    const Vector m = vectorExpm1 (x);
+    Vector AL = sn * m * (m + two) / (two * (m + one));
+    for (int l = 0; l < Vector::lanes; ++l)
+      if (x.get (l) > 64)
+        AL.set (l, sn.get (l) * sinh (x.get (l)));
+    c[0] = one + AL / A;
+    c[1] = -(two * cs);
+    c[2] = one - AL / A;
+    c[3] = one + AL * A;
+    c[4] = c[1];
+    c[5] = one - AL * A;
+  }
+};
+
+struct AllPassDesign
+{
+  template <class Vector>
+  static void design (const Vector* p, Vector* c)
+  {
+    const Vector one (1.), two (2.);
+    const Angle <Vector> a (p);
+    const Vector& cs = a.cs;
+    const Vector& sn = a.sn;
+    const Vector AL = sn / (two * p[2]);
+    c[0] = one + AL;
+    c[1] = -(two * cs);
+    c[2] = one - AL;
+    c[3] = c[2];
+    c[4] = c[1];
+    c[5] = c[0];
+  }
+};
+
+// Designs filters from first on, a vector of them at a time, and
+// returns the index of the first one left over.
+template <class Design, class Vector>
+int designVectors (int first,
+                   int count,
+                   int numParams,
+                   const double* const* params,
+                   const BiquadArrays <double>& dest)
+{
+  const double* src[Vector::lanes];
+  double* out[Vector::lanes];
+
+  for (; first + Vector::lanes <= count; first += Vector::lanes)
+  {
+    Vector p[4];
+    for (int j = 0; j < numParams; ++j)
+    {
+      for (int l = 0; l < Vector::lanes; ++l)
+        src[l] = params[j] + first + l;
+      p[j].load (src, 0);
+    }
+
+    Vector c[6];
+    Design::design (p, c);
+
+    const Vector scale = Vector (1.) / c[0];
+    double* const arrays[5] = { dest.m_a1, dest.m_a2, dest.m_b0, dest.m_b1, dest.m_b2 };
+    for (int j = 0; j < 5; ++j)
+    {
+      for (int l = 0; l < Vector::lanes; ++l)
+        out[l] = arrays[j] + first + l;
+      (c[j + 1] * scale).store (out, 0);
+    }
+  }
+
+  return first;
+}
+
+template <class Design>
+void designBatch (int count,
+                  int numParams,
+                  const double* const* params,
+                  const BiquadArrays <double>& dest)
+{
+  const int rest = designVectors <Design, LaneVector <maxLanes, double> > (
+    0, count, numParams, params, dest);
+  designVectors <Design, LaneVector <1, double> > (
+    rest, count, numParams, params, dest);
+}
+
+}
+
+namespace Batch {
+
+void LowPass::setup (int count,
+                     const double* sampleRate,
+                     const double* cutoffFrequency,
+                     const double* q,
+                     const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, cutoffFrequency, q };
+  designBatch <LowPassDesign> (count, 3, params, dest);
+}
+
+void HighPass::setup (int count,
+                      const double* sampleRate,
+                      const double* cutoffFrequency,
+                      const double* q,
+                      const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, cutoffFrequency, q };
+  designBatch <HighPassDesign> (count, 3, params, dest);
+}
+
+void BandPass1::setup (int count,
+                       const double* sampleRate,
+                       const double* centerFrequency,
+                       const double* bandWidth,
+                       const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, centerFrequency, bandWidth };
+  designBatch <BandPass1Design> (count, 3, params, dest);
+}
+
+void BandPass2::setup (int count,
+                       const double* sampleRate,
+                       const double* centerFrequency,
+                       const double* bandWidth,
+                       const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, centerFrequency, bandWidth };
+  designBatch <BandPass2Design> (count, 3, params, dest);
+}
+
+void BandStop::setup (int count,
+                      const double* sampleRate,
+                      const double* centerFrequency,
+                      const double* bandWidth,
+                      const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, centerFrequency, bandWidth };
+  designBatch <BandStopDesign> (count, 3, params, dest);
+}
+
+void LowShelf::setup (int count,
+                      const double* sampleRate,
+                      const double* cutoffFrequency,
+                      const double* gainDb,
+                      const double* shelfSlope,
+                      const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, cutoffFrequency, gainDb, shelfSlope };
+  designBatch <ShelfDesign <1> > (count, 4, params, dest);
+}
+
+void HighShelf::setup (int count,
+                       const double* sampleRate,
+                       const double* cutoffFrequency,
+                       const double* gainDb,
+                       const double* shelfSlope,
+                       const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, cutoffFrequency, gainDb, shelfSlope };
+  designBatch <ShelfDesign <-1> > (count, 4, params, dest);
+}
+
+void BandShelf::setup (int count,
+                       const double* sampleRate,
+                       const double* centerFrequency,
+                       const double* gainDb,
+                       const double* bandWidth,
+                       const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, centerFrequency, gainDb, bandWidth };
+  designBatch <BandShelfDesign> (count, 4, params, dest);
+}
+
+void AllPass::setup (int count,
+                     const double* sampleRate,
+                     const double* phaseFrequency,
+                     const double* q,
+                     const BiquadArrays <double>& dest)
+{
+  const double* params[] = { sampleRate, phaseFrequency, q };
+  designBatch <AllPassDesign> (count, 3, params, dest);
+}
+
+}
+
 }
 
 }
@@ -121,6 +121,115 @@ struct AllPass : BiquadBase
 
 //------------------------------------------------------------------------------
 
+//
+// Batch design of many raw filters at once
+//
+// Element i of each parameter array describes filter i, and its
+// coefficients go to element i of dest, ready for a VoiceBank. Filters
+// are designed a vector at a time, with vectorSin, vectorExp and
+// vectorSqrt in place of the library functions. Frequencies must be
+// from 0 to half the sample rate, exclusive for the band shelf, and
+// gains within +/-1000dB.
+//
+// The sines are taken of the distance to DC or to Nyquist, so nothing
+// cancels at the ends of the band. For gains within +/-60dB the
+// coefficients, divided by a0, are within 1e-13 of the exact values
+// of the formulae from DC to Nyquist: a1 and a2 in absolute terms, b0,
+// b1 and b2 relative to the largest of them. That is as close as
+// setup(), or closer near the ends of the band. Larger gains lose
+// precision in both, to 2e-12 at 120dB.
+//
+
+namespace Batch {
+
+struct LowPass
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* cutoffFrequency,
+                     const double* q,
+                     const BiquadArrays <double>& dest);
+};
+
+struct HighPass
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* cutoffFrequency,
+                     const double* q,
+                     const BiquadArrays <double>& dest);
+};
+
+struct BandPass1
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* centerFrequency,
+                     const double* bandWidth,
+                     const BiquadArrays <double>& dest);
+};
+
+struct BandPass2
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* centerFrequency,
+                     const double* bandWidth,
+                     const BiquadArrays <double>& dest);
+};
+
+struct BandStop
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* centerFrequency,
+                     const double* bandWidth,
+                     const BiquadArrays <double>& dest);
+};
+
+struct LowShelf
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* cutoffFrequency,
+                     const double* gainDb,
+                     const double* shelfSlope,
+                     const BiquadArrays <double>& dest);
+};
+
+struct HighShelf
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* cutoffFrequency,
+                     const double* gainDb,
+                     const double* shelfSlope,
+                     const BiquadArrays <double>& dest);
+};
+
+struct BandShelf
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* centerFrequency,
+                     const double* gainDb,
+                     const double* bandWidth,
+                     const BiquadArrays <double>& dest);
+};
+
+struct AllPass
+{
+  static void setup (int count,
+                     const double* sampleRate,
+                     const double* phaseFrequency,
+                     const double* q,
+                     const BiquadArrays <double>& dest);
+};
+
+}
+
+//------------------------------------------------------------------------------
+
 //
 // Gui-friendly Design layer
 //
@@ -0,0 +1,593 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+namespace Dsp {
+
+// Points on the unit circle, z^-1 = c1 - j s1 and z^-2 = c2 - j s2,
+// with consecutive frequencies in the lanes of each vector.
+struct FrequencyResponse::Block
+{
+  typedef LaneVector <maxLanes, double> vector_t;
+
+  enum
+  {
+    size = 64,
+    numVectors = size / vector_t::lanes,
+
+    // Stages multiplied together before the quotient of their
+    // numerators and denominators is taken. No single stage is
+    // anywhere near 1e75 from unity, so this cannot overflow.
+    stagesPerGroup = 4
+  };
+
+  // Vector i holds elements i * lanes and up of the array
+  static void toVectors (const double* src, vector_t* dest)
+  {
+    const double* lanes[vector_t::lanes];
+    for (int l = 0; l < vector_t::lanes; ++l)
+      lanes[l] = src + l;
+    for (int i = 0; i < numVectors; ++i)
+      dest[i].load (lanes, i * vector_t::lanes);
+  }
+
+  static void fromVectors (const vector_t* src, double* dest)
+  {
+    double* lanes[vector_t::lanes];
+    for (int l = 0; l < vector_t::lanes; ++l)
+      lanes[l] = dest + l;
+    for (int i = 0; i < numVectors; ++i)
+      src[i].store (lanes, i * vector_t::lanes);
+  }
+
+  static int vectorsFor (int count)
+  {
+    return (count + vector_t::lanes - 1) / vector_t::lanes;
+  }
+
+  // How the lanes of a vector are split about a quarter of the
+  // sample rate
+  enum Side
+  {
+    allLower,
+    allUpper,
+    mixed
+  };
+
+  // Squared magnitudes are taken as quadratics in x = sin^2 (w/2)
+  // below a quarter of the sample rate, and in x = cos^2 (w/2) above,
+  // so that neither 1 - cos w near DC nor 1 + cos w near Nyquist is
+  // formed by cancellation. In a mixed vector, lower is 1 in the lanes
+  // below and 0 in the others, and upper is the opposite.
+  void setHalfAngles (int numVectors)
+  {
+    double c[vector_t::lanes];
+    double s[vector_t::lanes];
+    double x[vector_t::lanes];
+    double l[vector_t::lanes];
+    double u[vector_t::lanes];
+    double* cl[vector_t::lanes];
+    double* sl[vector_t::lanes];
+    double* xl[vector_t::lanes];
+    double* ll[vector_t::lanes];
+    double* ul[vector_t::lanes];
+    for (int k = 0; k < vector_t::lanes; ++k)
+    {
+      cl[k] = c + k;
+      sl[k] = s + k;
+      xl[k] = x + k;
+      ll[k] = l + k;
+      ul[k] = u + k;
+    }
+
+    for (int i = 0; i < numVectors; ++i)
+    {
+      c1[i].store (cl, 0);
+      s1[i].store (sl, 0);
+      int numLower = 0;
+      for (int k = 0; k < vector_t::lanes; ++k)
+      {
+        // sin^2 (w/2) = sin^2 w / (2 (1 + cos w)), and the same for cos
+        const bool isLower = c[k] >= 0;
+        x[k] = s[k] * s[k] / (2 * (isLower ? 1 + c[k] : 1 - c[k]));
+        l[k] = isLower ? 1 : 0;
+        u[k] = isLower ? 0 : 1;
+        if (isLower)
+          ++numLower;
+      }
+      halfAngle[i].load (xl, 0);
+      lower[i].load (ll, 0);
+      upper[i].load (ul, 0);
+      side[i] = numLower == vector_t::lanes ? allLower :
+                (numLower == 0 ? allUpper : mixed);
+    }
+  }
+
+  vector_t c1[numVectors];
+  vector_t s1[numVectors];
+  vector_t c2[numVectors];
+  vector_t s2[numVectors];
+  vector_t halfAngle[numVectors];
+  vector_t lower[numVectors];
+  vector_t upper[numVectors];
+  Side side[numVectors];
+};
+
+//------------------------------------------------------------------------------
+
+// With S = b0 + b2, D = b0 - b2, P = b0 b2 and the DC response
+// R = b0 + b1 + b2, the quadratic in x = sin^2 (w/2) is
+//   R^2 - 4 (b1 S + 4 P) x + 16 P x^2
+//     = 16 P (x - p)^2 + c,  p = (S R - D^2) / 8P,  c = (4P - b1^2) D^2 / 4P
+// The second form is a sum of two terms which are not negative when
+// the zeros are complex or on the unit circle, so it stays exact next
+// to a zero. Otherwise the first form is used.
+void FrequencyResponse::Quadratic::set (double b0, double b1, double b2)
+{
+  const double r = b0 + b1 + b2;
+  const double sum = b0 + b2;
+  const double difference = b0 - b2;
+  const double product = b0 * b2;
+
+  k = 16 * product;
+
+  if (product > 0 && 4 * product >= b1 * b1)
+  {
+    p = (sum * r - difference * difference) / (8 * product);
+    c = (4 * product - b1 * b1) * difference * difference / (4 * product);
+    l = 0;
+  }
+  else
+  {
+    p = 0;
+    c = r * r;
+    l = -4 * (b1 * sum + 4 * product);
+  }
+}
+
+void FrequencyResponse::Quadratics::set (double b0, double b1, double b2,
+                                         double a1, double a2)
+{
+  numerator.set (b0, b1, b2);
+  denominator.set (1, a1, a2);
+}
+
+inline void FrequencyResponse::Quadratics::multiply (const Block::vector_t& x,
+                                                     Block::vector_t& n,
+                                                     Block::vector_t& d) const
+{
+  typedef Block::vector_t vector_t;
+  const vector_t xn = x - vector_t (numerator.p);
+  const vector_t xd = x - vector_t (denominator.p);
+  n = n * (vector_t (numerator.c) +
+           xn * (vector_t (numerator.l) + xn * vector_t (numerator.k)));
+  d = d * (vector_t (denominator.c) +
+           xd * (vector_t (denominator.l) + xd * vector_t (denominator.k)));
+}
+
+//------------------------------------------------------------------------------
+
+FrequencyResponse::FrequencyResponse ()
+{
+}
+
+FrequencyResponse::FrequencyResponse (const BiquadBase& stage)
+{
+  addStage (stage);
+}
+
+FrequencyResponse::FrequencyResponse (const Cascade& cascade)
+{
+  m_sectionArray.reserve (cascade.m_numStages);
+  for (int i = 0; i < cascade.m_numStages; ++i)
+    addStage (cascade.m_stageArray[i]);
+}
+
+void FrequencyResponse::clear ()
+{
+  m_sectionArray.clear ();
+}
+
+void FrequencyResponse::addStage (const BiquadBase& stage)
+{
+  Section s;
+  s.b0 = stage.m_b0;
+  s.b1 = stage.m_b1;
+  s.b2 = stage.m_b2;
+  s.a1 = stage.m_a1;
+  s.a2 = stage.m_a2;
+
+  // The constant terms are the squared responses at DC and Nyquist,
+  // formed from the coefficients directly. Nyquist is DC with the
+  // signs of b1 and a1 reversed.
+  s.lower.set (s.b0, s.b1, s.b2, s.a1, s.a2);
+  s.upper.set (s.b0, -s.b1, s.b2, -s.a1, s.a2);
+
+  m_sectionArray.push_back (s);
+}
+
+void FrequencyResponse::evaluate (int numFrequencies,
+                                  const double* normalizedFrequencies,
+                                  complex_t* dest) const
+{
+  Block block;
+  for (int i = 0; i < numFrequencies; i += Block::size)
+  {
+    const int count = std::min (int (Block::size), numFrequencies - i);
+    setPoints (count, normalizedFrequencies + i, block);
+    evaluateBlock (count, block, dest + i);
+  }
+}
+
+void FrequencyResponse::evaluate (int numFrequencies,
+                                  double first,
+                                  double spacing,
+                                  complex_t* dest) const
+{
+  Block block;
+  for (int i = 0; i < numFrequencies; i += Block::size)
+  {
+    const int count = std::min (int (Block::size), numFrequencies - i);
+    setPoints (count, first + i * spacing, spacing, block);
+    evaluateBlock (count, block, dest + i);
+  }
+}
+
+void FrequencyResponse::evaluate (Measure measure,
+                                  int numFrequencies,
+                                  const double* normalizedFrequencies,
+                                  double* dest) const
+{
+  Block block;
+  for (int i = 0; i < numFrequencies; i += Block::size)
+  {
+    const int count = std::min (int (Block::size), numFrequencies - i);
+    setPoints (count, normalizedFrequencies + i, block);
+    evaluateBlock (measure, count, block, dest + i);
+  }
+}
+
+void FrequencyResponse::evaluate (Measure measure,
+                                  int numFrequencies,
+                                  double first,
+                                  double spacing,
+                                  double* dest) const
+{
+  Block block;
+  for (int i = 0; i < numFrequencies; i += Block::size)
+  {
+    const int count = std::min (int (Block::size), numFrequencies - i);
+    setPoints (count, first + i * spacing, spacing, block);
+    evaluateBlock (measure, count, block, dest + i);
+  }
+}
+
+double FrequencyResponse::measureOf (Measure measure, complex_t response)
+{
+  switch (measure)
+  {
+  case magnitude:        return std::abs (response);
+  case magnitudeSquared: return std::norm (response);
+  case gainDb:           return 20 * log10 (std::abs (response));
+  case phase:            return std::arg (response);
+  };
+
+  return 0;
+}
+
+void FrequencyResponse::setPoints (int count,
+                                   const double* normalizedFrequencies,
+                                   Block& block)
+{
+  double c[Block::size];
+  double s[Block::size];
+
+  for (int k = 0; k < count; ++k)
+  {
+    const double w = 2 * doublePi * normalizedFrequencies[k];
+    c[k] = cos (w);
+    s[k] = sin (w);
+  }
+
+  // Unused lanes of a short block still get a valid point
+  for (int k = count; k < Block::size; ++k)
+  {
+    c[k] = 1;
+    s[k] = 0;
+  }
+
+  Block::toVectors (c, block.c1);
+  Block::toVectors (s, block.s1);
+
+  const Block::vector_t two (2);
+  for (int i = 0; i < Block::vectorsFor (count); ++i)
+  {
+    block.c2[i] = block.c1[i] * block.c1[i] - block.s1[i] * block.s1[i];
+    block.s2[i] = two * block.s1[i] * block.c1[i];
+  }
+
+  block.setHalfAngles (Block::vectorsFor (count));
+}
+
+void FrequencyResponse::setPoints (int count,
+                                   double first,
+                                   double spacing,
+                                   Block& block)
+{
+  typedef Block::vector_t vector_t;
+
+  // The first vector is stepped from an exact point one lane at a
+  // time, the rest are rotated from the one before by a whole vector.
+  const double w = 2 * doublePi * first;
+  const double dw = 2 * doublePi * spacing;
+  const double cd = cos (dw);
+  const double sd = sin (dw);
+  double c[vector_t::lanes];
+  double s[vector_t::lanes];
+  c[0] = cos (w);
+  s[0] = sin (w);
+  for (int l = 1; l < vector_t::lanes; ++l)
+  {
+    c[l] = c[l-1] * cd - s[l-1] * sd;
+    s[l] = s[l-1] * cd + c[l-1] * sd;
+  }
+
+  {
+    const double* cl[vector_t::lanes];
+    const double* sl[vector_t::lanes];
+    for (int l = 0; l < vector_t::lanes; ++l)
+    {
+      cl[l] = c + l;
+      sl[l] = s + l;
+    }
+    block.c1[0].load (cl, 0);
+    block.s1[0].load (sl, 0);
+  }
+
+  const vector_t cv (cos (vector_t::lanes * dw));
+  const vector_t sv (sin (vector_t::lanes * dw));
+  const vector_t two (2);
+  const int numVectors = Block::vectorsFor (count);
+  for (int i = 0; i < numVectors; ++i)
+  {
+    if (i > 0)
+    {
+      block.c1[i] = block.c1[i-1] * cv - block.s1[i-1] * sv;
+      block.s1[i] = block.s1[i-1] * cv + block.c1[i-1] * sv;
+    }
+
+    block.c2[i] = block.c1[i] * block.c1[i] - block.s1[i] * block.s1[i];
+    block.s2[i] = two * block.s1[i] * block.c1[i];
+  }
+
+  block.setHalfAngles (numVectors);
+}
+
+void FrequencyResponse::evaluateBlock (int count,
+                                       Block& block,
+                                       complex_t* dest) const
+{
+  typedef Block::vector_t vector_t;
+
+  const int numVectors = Block::vectorsFor (count);
+  const int numStages = getNumStages ();
+  const Section* const sections = numStages > 0 ? &m_sectionArray[0] : 0;
+  const vector_t zero (0);
+  const vector_t one (1);
+  vector_t hr[Block::numVectors];
+  vector_t hi[Block::numVectors];
+
+  // Each vector of frequencies goes through all the stages while its
+  // products stay in registers. The numerators and denominators of a
+  // group of stages are multiplied separately, and the quotient of the
+  // group is folded into the result with a single division.
+  for (int j = 0; j < numVectors; ++j)
+  {
+    const vector_t c1 = block.c1[j];
+    const vector_t s1 = block.s1[j];
+    const vector_t c2 = block.c2[j];
+    const vector_t s2 = block.s2[j];
+    vector_t r = one;
+    vector_t i = zero;
+
+    for (int first = 0; first < numStages; first += Block::stagesPerGroup)
+    {
+      const int last = std::min (first + int (Block::stagesPerGroup), numStages);
+      vector_t nr = one;
+      vector_t ni = zero;
+      vector_t dr = one;
+      vector_t di = zero;
+
+      for (const Section* s = sections + first; s < sections + last; ++s)
+      {
+        const vector_t b1 (s->b1);
+        const vector_t b2 (s->b2);
+        const vector_t a1 (s->a1);
+        const vector_t a2 (s->a2);
+        const vector_t xr = vector_t (s->b0) + b1 * c1 + b2 * c2;
+        const vector_t xi = zero - (b1 * s1 + b2 * s2);
+        const vector_t yr = one + a1 * c1 + a2 * c2;
+        const vector_t yi = zero - (a1 * s1 + a2 * s2);
+        const vector_t tn = nr * xr - ni * xi;
+        ni = nr * xi + ni * xr;
+        nr = tn;
+        const vector_t td = dr * yr - di * yi;
+        di = dr * yi + di * yr;
+        dr = td;
+      }
+
+      // h *= n conj(d) / |d|^2
+      const vector_t rd = one / (dr * dr + di * di);
+      const vector_t qr = (nr * dr + ni * di) * rd;
+      const vector_t qi = (ni * dr - nr * di) * rd;
+      const vector_t t = r * qr - i * qi;
+      i = r * qi + i * qr;
+      r = t;
+    }
+
+    hr[j] = r;
+    hi[j] = i;
+  }
+
+  double re[Block::size];
+  double im[Block::size];
+  Block::fromVectors (hr, re);
+  Block::fromVectors (hi, im);
+
+  for (int k = 0; k < count; ++k)
+    dest[k] = complex_t (re[k], im[k]);
+}
+
+void FrequencyResponse::evaluateBlock (Measure measure,
+                                       int count,
+                                       Block& block,
+                                       double* dest) const
+{
+  typedef Block::vector_t vector_t;
+
+  if (measure == phase)
+  {
+    complex_t h[Block::size];
+    evaluateBlock (count, block, h);
+    for (int k = 0; k < count; ++k)
+      dest[k] = std::arg (h[k]);
+    return;
+  }
+
+  // Squared magnitudes are real, so only the half angle is needed. For
+  // decibels, a running product which strays far from unity is
+  // moved into a sum of logarithms, so that the steep skirts of
+  // high order designs do not underflow.
+  const bool inLogs = (measure == gainDb);
+  const int numVectors = Block::vectorsFor (count);
+  const int numStages = getNumStages ();
+  const Section* const sections = numStages > 0 ? &m_sectionArray[0] : 0;
+  const vector_t one (1);
+  vector_t h[Block::numVectors];
+  double hs[Block::size];
+  double logSum[Block::size];
+
+  for (int j = 0; j < numVectors; ++j)
+    h[j] = one;
+
+  for (int k = 0; k < count; ++k)
+    logSum[k] = 0;
+
+  for (int first = 0; first < numStages; first += Block::stagesPerGroup)
+  {
+    const int last = std::min (first + int (Block::stagesPerGroup), numStages);
+
+    for (int j = 0; j < numVectors; ++j)
+    {
+      const vector_t x = block.halfAngle[j];
+      vector_t n = one;
+      vector_t d = one;
+
+      if (block.side[j] == Block::mixed)
+      {
+        // Both quadratics are evaluated and the unused one multiplied
+        // by zero, which keeps the other exact
+        const vector_t lower = block.lower[j];
+        const vector_t upper = block.upper[j];
+        for (const Section* s = sections + first; s < sections + last; ++s)
+        {
+          vector_t nl = one;
+          vector_t dl = one;
+          vector_t nu = one;
+          vector_t du = one;
+          s->lower.multiply (x, nl, dl);
+          s->upper.multiply (x, nu, du);
+          n = n * (lower * nl + upper * nu);
+          d = d * (lower * dl + upper * du);
+        }
+      }
+      else
+      {
+        const Quadratics Section::* side =
+          block.side[j] == Block::allLower ? &Section::lower : &Section::upper;
+        for (const Section* s = sections + first; s < sections + last; ++s)
+          (s->*side).multiply (x, n, d);
+      }
+
+      h[j] = h[j] * n / d;
+    }
+
+    if (inLogs)
+    {
+      Block::fromVectors (h, hs);
+
+      bool moved = false;
+      for (int k = 0; k < count; ++k)
+      {
+        // Rounding can leave a value at a zero slightly negative
+        const double v = std::abs (hs[k]);
+        if (v < 1e-100 || v > 1e100)
+        {
+          logSum[k] += log (v);
+          hs[k] = 1;
+          moved = true;
+        }
+      }
+
+      if (moved)
+        Block::toVectors (hs, h);
+    }
+  }
+
+  Block::fromVectors (h, hs);
+
+  switch (measure)
+  {
+  case magnitude:
+    for (int k = 0; k < count; ++k)
+      dest[k] = sqrt (std::abs (hs[k]));
+    break;
+
+  case magnitudeSquared:
+    for (int k = 0; k < count; ++k)
+      dest[k] = std::abs (hs[k]);
+    break;
+
+  default:
+    {
+      // 20 log10 |H| = 10 log10 |H|^2
+      const double scale = 10 / log (10.);
+      for (int k = 0; k < count; ++k)
+        dest[k] = scale * (logSum[k] + log (std::abs (hs[k])));
+    }
+    break;
+  };
+}
+
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_RESPONSE_H
+#define DSPFILTERS_RESPONSE_H
+
+namespace Dsp {
+
+/*
+ * Frequency response of a set of second order sections, evaluated
+ * at many frequencies at once.
+ *
+ * The coefficients are rearranged once when the object is made, so
+ * keep it around to evaluate the same filter again. Frequencies are
+ * handled in blocks, a LaneVector of them at a time, with the loop
+ * over a block innermost. When they are evenly spaced, the points on
+ * the unit circle come from rotating earlier ones instead of from
+ * calls to cos() and sin().
+ *
+ * The magnitude measures need no complex arithmetic. They keep their
+ * precision all the way down to DC and up to Nyquist, where a stopband
+ * can be 100 dB or more below the passband; tests/ResponseAccuracy
+ * compares them against response().
+ *
+ */
+
+class FrequencyResponse
+{
+public:
+  enum Measure
+  {
+    magnitude,        // |H|
+    magnitudeSquared, // |H|^2, using only real arithmetic
+    gainDb,           // 20 log10 |H|, accumulated in the log domain
+    phase             // arg H in radians, from -pi to pi
+  };
+
+  FrequencyResponse ();
+  explicit FrequencyResponse (const BiquadBase& stage);
+  explicit FrequencyResponse (const Cascade& cascade);
+
+  void clear ();
+  void addStage (const BiquadBase& stage);
+
+  int getNumStages () const
+  {
+    return int (m_sectionArray.size ());
+  }
+
+  // Same as the response() of the stages, at each frequency
+  void evaluate (int numFrequencies,
+                 const double* normalizedFrequencies,
+                 complex_t* dest) const;
+
+  // The frequencies are first, first + spacing, first + 2 * spacing...
+  void evaluate (int numFrequencies,
+                 double first,
+                 double spacing,
+                 complex_t* dest) const;
+
+  void evaluate (Measure measure,
+                 int numFrequencies,
+                 const double* normalizedFrequencies,
+                 double* dest) const;
+
+  void evaluate (Measure measure,
+                 int numFrequencies,
+                 double first,
+                 double spacing,
+                 double* dest) const;
+
+  // The measure of a single complex response
+  static double measureOf (Measure measure, complex_t response);
+
+private:
+  struct Block;
+
+  // A squared magnitude |b0 + b1 z^-1 + b2 z^-2|^2 as a quadratic in
+  // x = sin^2 (w/2) about DC, or in x = cos^2 (w/2) about Nyquist,
+  // written as c + (x - p) (l + k (x - p))
+  struct Quadratic
+  {
+    double c, p, l, k;
+
+    void set (double b0, double b1, double b2);
+  };
+
+  // The numerator and denominator of a stage, about DC or Nyquist
+  struct Quadratics
+  {
+    Quadratic numerator;
+    Quadratic denominator;
+
+    void set (double b0, double b1, double b2, double a1, double a2);
+
+    void multiply (const LaneVector <maxLanes, double>& x,
+                   LaneVector <maxLanes, double>& n,
+                   LaneVector <maxLanes, double>& d) const;
+  };
+
+  // Coefficients of a stage, divided by a0
+  struct Section
+  {
+    double b0, b1, b2;
+    double a1, a2;
+    Quadratics lower;
+    Quadratics upper;
+  };
+
+  static void setPoints (int count,
+                         const double* normalizedFrequencies,
+                         Block& block);
+
+  static void setPoints (int count,
+                         double first,
+                         double spacing,
+                         Block& block);
+
+  void evaluateBlock (int count, Block& block, complex_t* dest) const;
+
+  void evaluateBlock (Measure measure,
+                      int count,
+                      Block& block,
+                      double* dest) const;
+
+  std::vector<Section> m_sectionArray;
+};
+
+}
+
+#endif
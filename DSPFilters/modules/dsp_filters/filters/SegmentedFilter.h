@@ -0,0 +1,267 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_SEGMENTEDFILTER_H
+#define DSPFILTERS_SEGMENTEDFILTER_H
+
+namespace Dsp {
+
+/*
+ * Filters one long channel on several cores
+ *
+ * Each block given to process() is cut into as many segments as the
+ * WorkerPool has threads, and every segment after the first is filtered
+ * from rest at the same time as the others. The response to the state
+ * a segment should have started in is a decaying homogeneous response,
+ * so once the segments are done, each one has its first samples filtered
+ * again starting from the end state of the segment before it, until that
+ * response has decayed by a factor of 10^10 (the settle length). The
+ * result matches filtering the block in one piece to about ten decimal
+ * places, and the state carries over to the next block.
+ *
+ * Segments are kept at least eight settle lengths long, so blocks that
+ * are short for the filter's poles are filtered on the calling thread.
+ *
+ */
+
+template <class StateType = DirectFormII>
+class SegmentedFilter
+{
+public:
+  typedef typename StateType::value_t value_t;
+  typedef typename StateType::coefficient_t coefficient_t;
+
+  enum
+  {
+    // Shortest segment worth handing to another thread
+    minSegmentSize = 16384
+  };
+
+  explicit SegmentedFilter (const Cascade& cascade)
+    : m_pool (0)
+  {
+    for (int i = 0; i < cascade.getNumStages (); ++i)
+      m_stages.push_back (stage_t (cascade[i]));
+    m_state.resize (m_stages.size ());
+    m_settleLength = findSettleLength ();
+  }
+
+  explicit SegmentedFilter (const BiquadBase& biquad)
+    : m_pool (0)
+  {
+    m_stages.push_back (stage_t (biquad));
+    m_state.resize (m_stages.size ());
+    m_settleLength = findSettleLength ();
+  }
+
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_pool = pool;
+  }
+
+  // Samples filtered again at the start of each segment, chosen
+  // from the poles when the filter is given
+  void setSettleLength (size_t settleLength)
+  {
+    m_settleLength = settleLength;
+  }
+
+  size_t getSettleLength () const
+  {
+    return m_settleLength;
+  }
+
+  void reset ()
+  {
+    for (size_t j = 0; j < m_state.size (); ++j)
+      m_state[j].reset ();
+  }
+
+  template <typename Sample>
+  void process (size_t numSamples, Sample* dest)
+  {
+    if (numSamples == 0 || m_stages.empty ())
+      return;
+
+    const size_t segmentSize = m_settleLength < size_t (-1) / 8 ?
+      std::max (size_t (minSegmentSize), 8 * m_settleLength) : size_t (-1);
+    const size_t numSegments = m_pool ?
+      std::min (size_t (m_pool->getNumWorkers () + 1),
+                numSamples / segmentSize) : 1;
+
+    if (numSegments > 1)
+    {
+      Task <Sample> task (*this, numSamples, dest, int (numSegments));
+      m_pool->run (task, int (numSegments));
+      task.setSettling ();
+      m_pool->run (task, int (numSegments) - 1);
+      task.getEndState (&m_state[0]);
+    }
+    else
+    {
+      ScopedFlushDenormals flush;
+      filter (numSamples, dest, &m_state[0]);
+    }
+  }
+
+private:
+  typedef BiquadCoefficients <coefficient_t> stage_t;
+
+  // Filters the segments from rest, then settles the start of each
+  // segment after the first, one part per segment in both cases.
+  template <typename Sample>
+  class Task : public WorkerPool::Task
+  {
+  public:
+    Task (const SegmentedFilter& filter,
+          size_t numSamples,
+          Sample* dest,
+          int numSegments)
+      : m_filter (filter)
+      , m_numStages (int (filter.m_stages.size ()))
+      , m_numSamples (numSamples)
+      , m_dest (dest)
+      , m_numSegments (numSegments)
+      , m_settling (false)
+      , m_states (numSegments * filter.m_stages.size ())
+      , m_heads ((numSegments - 1) * filter.m_settleLength)
+    {
+      // the first segment carries on from the filter's state
+      for (int j = 0; j < m_numStages; ++j)
+        m_states[j] = filter.m_state[j];
+
+      // the filtered segments overwrite the input which is settled again
+      for (int k = 1; k < numSegments; ++k)
+        for (size_t i = 0; i < filter.m_settleLength; ++i)
+          m_heads[(k - 1) * filter.m_settleLength + i] =
+            m_dest[getStart (k) + i];
+    }
+
+    void setSettling ()
+    {
+      m_settling = true;
+    }
+
+    // The state at the end of the last segment, as if the
+    // whole block had been filtered in one piece
+    void getEndState (StateType* states) const
+    {
+      for (int j = 0; j < m_numStages; ++j)
+        states[j] = m_states[(m_numSegments - 1) * m_numStages + j];
+    }
+
+    void run (int part)
+    {
+      ScopedFlushDenormals flush;
+
+      if (!m_settling)
+      {
+        const size_t start = getStart (part);
+        m_filter.filter (getStart (part + 1) - start, m_dest + start,
+                         &m_states[part * m_numStages]);
+      }
+      else
+      {
+        // segment k starts where k - 1 ended, with the input it had.
+        // The end state of k - 1 was reached from rest, but that
+        // differs from the true one only by a response which has
+        // long decayed.
+        const int k = part + 1;
+        const size_t n = m_filter.m_settleLength;
+        std::vector<StateType> states (
+          m_states.begin () + (k - 1) * m_numStages,
+          m_states.begin () + k * m_numStages);
+        Sample* const head = m_dest + getStart (k);
+        for (size_t i = 0; i < n; ++i)
+          head[i] = static_cast<Sample> (m_heads[(k - 1) * n + i]);
+        m_filter.filter (n, head, &states[0]);
+      }
+    }
+
+  private:
+    size_t getStart (int segment) const
+    {
+      return m_numSamples * segment / m_numSegments;
+    }
+
+  private:
+    const SegmentedFilter& m_filter;
+    const int m_numStages;
+    const size_t m_numSamples;
+    Sample* const m_dest;
+    const int m_numSegments;
+    bool m_settling;
+    std::vector<StateType> m_states;
+    std::vector<Sample> m_heads;
+  };
+
+  // Filters in place from the given states, a tile at a time
+  // so that samples pass between stages in the state's precision.
+  template <typename Sample>
+  void filter (size_t numSamples, Sample* dest, StateType* states) const
+  {
+    value_t buf [Cascade::stageBlockSize];
+
+    for (size_t offset = 0; offset < numSamples; offset += Cascade::stageBlockSize)
+    {
+      const size_t n = std::min (numSamples - offset,
+                                 size_t (Cascade::stageBlockSize));
+      for (size_t i = 0; i < n; ++i)
+        buf[i] = static_cast<value_t> (dest[offset + i]);
+      processSections (n, buf, int (m_stages.size ()), &m_stages[0], states);
+      for (size_t i = 0; i < n; ++i)
+        dest[offset + i] = static_cast<Sample> (buf[i]);
+    }
+  }
+
+  // Samples after which the homogeneous response has decayed by 10^10
+  size_t findSettleLength () const
+  {
+    if (m_stages.empty ())
+      return 0;
+
+    return decayLength (int (m_stages.size ()), &m_stages[0], 1e-10);
+  }
+
+private:
+  std::vector<stage_t> m_stages;
+  std::vector<StateType> m_state;
+  WorkerPool* m_pool;
+  size_t m_settleLength;
+};
+
+}
+
+#endif
@@ -0,0 +1,1068 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_SIMD_H
+#define DSPFILTERS_SIMD_H
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DSPFILTERS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#define DSPFILTERS_AVX 1
+#include <immintrin.h>
+#endif
+
+namespace Dsp {
+
+/*
+ * Vectors of floating point values used to process several
+ * channels in lock-step, one channel in each lane. FrequencyResponse
+ * also uses them to evaluate several frequencies at once.
+ *
+ * Widths which the hardware does not support directly are
+ * built out of two vectors of half the width, so every power
+ * of two is available. The compiler decides the instruction
+ * set: SSE2 for two double or four float lanes, and AVX for
+ * four double or eight float lanes, when enabled.
+ *
+ */
+
+template <int Lanes, typename Value = double>
+struct LaneVector
+{
+  typedef LaneVector <Lanes / 2, Value> half_t;
+
+  enum
+  {
+    lanes = Lanes
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (Value v)
+    : lo (v)
+    , hi (v)
+  {
+  }
+
+  LaneVector (const half_t& lo_, const half_t& hi_)
+    : lo (lo_)
+    , hi (hi_)
+  {
+  }
+
+  Value get (int lane) const
+  {
+    return (lane < Lanes / 2) ? lo.get (lane) : hi.get (lane - Lanes / 2);
+  }
+
+  void set (int lane, Value v)
+  {
+    if (lane < Lanes / 2)
+      lo.set (lane, v);
+    else
+      hi.set (lane - Lanes / 2, v);
+  }
+
+  // Gather sample [index] from each of Lanes channels, given
+  // either an array of channel pointers or InterleavedChannels
+  template <class Channels>
+  void load (const Channels& channels, int index)
+  {
+    lo.load (channels, index);
+    hi.load (channels + Lanes / 2, index);
+  }
+
+  // Scatter each lane to sample [index] of its channel
+  template <class Channels>
+  void store (const Channels& channels, int index) const
+  {
+    lo.store (channels, index);
+    hi.store (channels + Lanes / 2, index);
+  }
+
+  // Sum of all the lanes
+  Value sum () const
+  {
+    return lo.sum () + hi.sum ();
+  }
+
+  half_t lo;
+  half_t hi;
+};
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> operator+ (const LaneVector <Lanes, Value>& a,
+                                            const LaneVector <Lanes, Value>& b)
+{
+  return LaneVector <Lanes, Value> (a.lo + b.lo, a.hi + b.hi);
+}
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> operator- (const LaneVector <Lanes, Value>& a,
+                                            const LaneVector <Lanes, Value>& b)
+{
+  return LaneVector <Lanes, Value> (a.lo - b.lo, a.hi - b.hi);
+}
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> operator* (const LaneVector <Lanes, Value>& a,
+                                            const LaneVector <Lanes, Value>& b)
+{
+  return LaneVector <Lanes, Value> (a.lo * b.lo, a.hi * b.hi);
+}
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> operator/ (const LaneVector <Lanes, Value>& a,
+                                            const LaneVector <Lanes, Value>& b)
+{
+  return LaneVector <Lanes, Value> (a.lo / b.lo, a.hi / b.hi);
+}
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> operator- (const LaneVector <Lanes, Value>& a)
+{
+  return LaneVector <Lanes, Value> (-a.lo, -a.hi);
+}
+
+template <int Lanes, typename Value>
+inline LaneVector <Lanes, Value> vectorSqrt (const LaneVector <Lanes, Value>& a)
+{
+  return LaneVector <Lanes, Value> (vectorSqrt (a.lo), vectorSqrt (a.hi));
+}
+
+//------------------------------------------------------------------------------
+
+// Scalar lane, this ends the recursion
+template <typename Value>
+struct LaneVector <1, Value>
+{
+  enum
+  {
+    lanes = 1
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (Value v)
+    : m_v (v)
+  {
+  }
+
+  Value get (int) const
+  {
+    return m_v;
+  }
+
+  void set (int, Value v)
+  {
+    m_v = v;
+  }
+
+  template <typename Sample>
+  void load (Sample* const* channels, int index)
+  {
+    m_v = static_cast<Value> (channels[0][index]);
+  }
+
+  template <typename Sample>
+  void store (Sample* const* channels, int index) const
+  {
+    channels[0][index] = static_cast<Sample> (m_v);
+  }
+
+  template <typename Sample>
+  void load (const InterleavedChannels <Sample>& channels, int index)
+  {
+    m_v = static_cast<Value> (*channels.frame (index));
+  }
+
+  template <typename Sample>
+  void store (const InterleavedChannels <Sample>& channels, int index) const
+  {
+    *channels.frame (index) = static_cast<Sample> (m_v);
+  }
+
+  Value sum () const
+  {
+    return m_v;
+  }
+
+  Value m_v;
+};
+
+template <typename Value>
+inline LaneVector <1, Value> operator+ (const LaneVector <1, Value>& a,
+                                        const LaneVector <1, Value>& b)
+{
+  return LaneVector <1, Value> (a.m_v + b.m_v);
+}
+
+template <typename Value>
+inline LaneVector <1, Value> operator- (const LaneVector <1, Value>& a,
+                                        const LaneVector <1, Value>& b)
+{
+  return LaneVector <1, Value> (a.m_v - b.m_v);
+}
+
+template <typename Value>
+inline LaneVector <1, Value> operator* (const LaneVector <1, Value>& a,
+                                        const LaneVector <1, Value>& b)
+{
+  return LaneVector <1, Value> (a.m_v * b.m_v);
+}
+
+template <typename Value>
+inline LaneVector <1, Value> operator/ (const LaneVector <1, Value>& a,
+                                        const LaneVector <1, Value>& b)
+{
+  return LaneVector <1, Value> (a.m_v / b.m_v);
+}
+
+template <typename Value>
+inline LaneVector <1, Value> operator- (const LaneVector <1, Value>& a)
+{
+  return LaneVector <1, Value> (-a.m_v);
+}
+
+template <typename Value>
+inline LaneVector <1, Value> vectorSqrt (const LaneVector <1, Value>& a)
+{
+  return LaneVector <1, Value> (std::sqrt (a.m_v));
+}
+
+//------------------------------------------------------------------------------
+
+#if DSPFILTERS_SSE2
+
+template <>
+struct LaneVector <2, double>
+{
+  enum
+  {
+    lanes = 2
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (double v)
+    : m_v (_mm_set1_pd (v))
+  {
+  }
+
+  explicit LaneVector (__m128d v)
+    : m_v (v)
+  {
+  }
+
+  double get (int lane) const
+  {
+    double v[2];
+    _mm_storeu_pd (v, m_v);
+    return v[lane];
+  }
+
+  void set (int lane, double v)
+  {
+    double a[2];
+    _mm_storeu_pd (a, m_v);
+    a[lane] = v;
+    m_v = _mm_loadu_pd (a);
+  }
+
+  template <typename Sample>
+  void load (Sample* const* channels, int index)
+  {
+    m_v = _mm_set_pd (channels[1][index], channels[0][index]);
+  }
+
+  template <typename Sample>
+  void store (Sample* const* channels, int index) const
+  {
+    double v[2];
+    _mm_storeu_pd (v, m_v);
+    channels[0][index] = static_cast<Sample> (v[0]);
+    channels[1][index] = static_cast<Sample> (v[1]);
+  }
+
+  // The lanes of an interleaved frame are adjacent
+  template <typename Sample>
+  void load (const InterleavedChannels <Sample>& channels, int index)
+  {
+    const Sample* p = channels.frame (index);
+    m_v = _mm_set_pd (p[1], p[0]);
+  }
+
+  template <typename Sample>
+  void store (const InterleavedChannels <Sample>& channels, int index) const
+  {
+    double v[2];
+    _mm_storeu_pd (v, m_v);
+    Sample* p = channels.frame (index);
+    p[0] = static_cast<Sample> (v[0]);
+    p[1] = static_cast<Sample> (v[1]);
+  }
+
+  void load (const InterleavedChannels <double>& channels, int index)
+  {
+    m_v = _mm_loadu_pd (channels.frame (index));
+  }
+
+  void store (const InterleavedChannels <double>& channels, int index) const
+  {
+    _mm_storeu_pd (channels.frame (index), m_v);
+  }
+
+  void load (const InterleavedChannels <float>& channels, int index)
+  {
+    m_v = _mm_cvtps_pd (_mm_castpd_ps (
+      _mm_load_sd (reinterpret_cast<const double*> (channels.frame (index)))));
+  }
+
+  void store (const InterleavedChannels <float>& channels, int index) const
+  {
+    _mm_store_sd (reinterpret_cast<double*> (channels.frame (index)),
+                  _mm_castps_pd (_mm_cvtpd_ps (m_v)));
+  }
+
+  double sum () const
+  {
+    double v[2];
+    _mm_storeu_pd (v, m_v);
+    double r = v[0];
+    for (int i = 1; i < 2; ++i)
+      r += v[i];
+    return r;
+  }
+
+  __m128d m_v;
+};
+
+inline LaneVector <2, double> operator+ (const LaneVector <2, double>& a,
+                                         const LaneVector <2, double>& b)
+{
+  return LaneVector <2, double> (_mm_add_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <2, double> operator- (const LaneVector <2, double>& a,
+                                         const LaneVector <2, double>& b)
+{
+  return LaneVector <2, double> (_mm_sub_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <2, double> operator* (const LaneVector <2, double>& a,
+                                         const LaneVector <2, double>& b)
+{
+  return LaneVector <2, double> (_mm_mul_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <2, double> operator/ (const LaneVector <2, double>& a,
+                                         const LaneVector <2, double>& b)
+{
+  return LaneVector <2, double> (_mm_div_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <2, double> operator- (const LaneVector <2, double>& a)
+{
+  return LaneVector <2, double> (_mm_xor_pd (a.m_v, _mm_set1_pd (-0.)));
+}
+
+inline LaneVector <2, double> vectorSqrt (const LaneVector <2, double>& a)
+{
+  return LaneVector <2, double> (_mm_sqrt_pd (a.m_v));
+}
+
+//------------------------------------------------------------------------------
+
+template <>
+struct LaneVector <4, float>
+{
+  enum
+  {
+    lanes = 4
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (float v)
+    : m_v (_mm_set1_ps (v))
+  {
+  }
+
+  explicit LaneVector (__m128 v)
+    : m_v (v)
+  {
+  }
+
+  float get (int lane) const
+  {
+    float v[4];
+    _mm_storeu_ps (v, m_v);
+    return v[lane];
+  }
+
+  void set (int lane, float v)
+  {
+    float a[4];
+    _mm_storeu_ps (a, m_v);
+    a[lane] = v;
+    m_v = _mm_loadu_ps (a);
+  }
+
+  template <typename Sample>
+  void load (Sample* const* channels, int index)
+  {
+    m_v = _mm_set_ps (static_cast<float> (channels[3][index]),
+                      static_cast<float> (channels[2][index]),
+                      static_cast<float> (channels[1][index]),
+                      static_cast<float> (channels[0][index]));
+  }
+
+  template <typename Sample>
+  void store (Sample* const* channels, int index) const
+  {
+    float v[4];
+    _mm_storeu_ps (v, m_v);
+    channels[0][index] = static_cast<Sample> (v[0]);
+    channels[1][index] = static_cast<Sample> (v[1]);
+    channels[2][index] = static_cast<Sample> (v[2]);
+    channels[3][index] = static_cast<Sample> (v[3]);
+  }
+
+  // The lanes of an interleaved frame are adjacent
+  template <typename Sample>
+  void load (const InterleavedChannels <Sample>& channels, int index)
+  {
+    const Sample* p = channels.frame (index);
+    m_v = _mm_set_ps (static_cast<float> (p[3]),
+                      static_cast<float> (p[2]),
+                      static_cast<float> (p[1]),
+                      static_cast<float> (p[0]));
+  }
+
+  template <typename Sample>
+  void store (const InterleavedChannels <Sample>& channels, int index) const
+  {
+    float v[4];
+    _mm_storeu_ps (v, m_v);
+    Sample* p = channels.frame (index);
+    for (int i = 0; i < 4; ++i)
+      p[i] = static_cast<Sample> (v[i]);
+  }
+
+  void load (const InterleavedChannels <float>& channels, int index)
+  {
+    m_v = _mm_loadu_ps (channels.frame (index));
+  }
+
+  void store (const InterleavedChannels <float>& channels, int index) const
+  {
+    _mm_storeu_ps (channels.frame (index), m_v);
+  }
+
+  float sum () const
+  {
+    float v[4];
+    _mm_storeu_ps (v, m_v);
+    float r = v[0];
+    for (int i = 1; i < 4; ++i)
+      r += v[i];
+    return r;
+  }
+
+  __m128 m_v;
+};
+
+inline LaneVector <4, float> operator+ (const LaneVector <4, float>& a,
+                                        const LaneVector <4, float>& b)
+{
+  return LaneVector <4, float> (_mm_add_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, float> operator- (const LaneVector <4, float>& a,
+                                        const LaneVector <4, float>& b)
+{
+  return LaneVector <4, float> (_mm_sub_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, float> operator* (const LaneVector <4, float>& a,
+                                        const LaneVector <4, float>& b)
+{
+  return LaneVector <4, float> (_mm_mul_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, float> operator/ (const LaneVector <4, float>& a,
+                                        const LaneVector <4, float>& b)
+{
+  return LaneVector <4, float> (_mm_div_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, float> operator- (const LaneVector <4, float>& a)
+{
+  return LaneVector <4, float> (_mm_xor_ps (a.m_v, _mm_set1_ps (-0.f)));
+}
+
+inline LaneVector <4, float> vectorSqrt (const LaneVector <4, float>& a)
+{
+  return LaneVector <4, float> (_mm_sqrt_ps (a.m_v));
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+#if DSPFILTERS_AVX
+
+template <>
+struct LaneVector <4, double>
+{
+  enum
+  {
+    lanes = 4
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (double v)
+    : m_v (_mm256_set1_pd (v))
+  {
+  }
+
+  explicit LaneVector (__m256d v)
+    : m_v (v)
+  {
+  }
+
+  double get (int lane) const
+  {
+    double v[4];
+    _mm256_storeu_pd (v, m_v);
+    return v[lane];
+  }
+
+  void set (int lane, double v)
+  {
+    double a[4];
+    _mm256_storeu_pd (a, m_v);
+    a[lane] = v;
+    m_v = _mm256_loadu_pd (a);
+  }
+
+  template <typename Sample>
+  void load (Sample* const* channels, int index)
+  {
+    m_v = _mm256_set_pd (channels[3][index], channels[2][index],
+                         channels[1][index], channels[0][index]);
+  }
+
+  template <typename Sample>
+  void store (Sample* const* channels, int index) const
+  {
+    double v[4];
+    _mm256_storeu_pd (v, m_v);
+    channels[0][index] = static_cast<Sample> (v[0]);
+    channels[1][index] = static_cast<Sample> (v[1]);
+    channels[2][index] = static_cast<Sample> (v[2]);
+    channels[3][index] = static_cast<Sample> (v[3]);
+  }
+
+  // The lanes of an interleaved frame are adjacent
+  template <typename Sample>
+  void load (const InterleavedChannels <Sample>& channels, int index)
+  {
+    const Sample* p = channels.frame (index);
+    m_v = _mm256_set_pd (p[3], p[2], p[1], p[0]);
+  }
+
+  template <typename Sample>
+  void store (const InterleavedChannels <Sample>& channels, int index) const
+  {
+    double v[4];
+    _mm256_storeu_pd (v, m_v);
+    Sample* p = channels.frame (index);
+    for (int i = 0; i < 4; ++i)
+      p[i] = static_cast<Sample> (v[i]);
+  }
+
+  void load (const InterleavedChannels <double>& channels, int index)
+  {
+    m_v = _mm256_loadu_pd (channels.frame (index));
+  }
+
+  void store (const InterleavedChannels <double>& channels, int index) const
+  {
+    _mm256_storeu_pd (channels.frame (index), m_v);
+  }
+
+  void load (const InterleavedChannels <float>& channels, int index)
+  {
+    m_v = _mm256_cvtps_pd (_mm_loadu_ps (channels.frame (index)));
+  }
+
+  void store (const InterleavedChannels <float>& channels, int index) const
+  {
+    _mm_storeu_ps (channels.frame (index), _mm256_cvtpd_ps (m_v));
+  }
+
+  double sum () const
+  {
+    double v[4];
+    _mm256_storeu_pd (v, m_v);
+    double r = v[0];
+    for (int i = 1; i < 4; ++i)
+      r += v[i];
+    return r;
+  }
+
+  __m256d m_v;
+};
+
+inline LaneVector <4, double> operator+ (const LaneVector <4, double>& a,
+                                         const LaneVector <4, double>& b)
+{
+  return LaneVector <4, double> (_mm256_add_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, double> operator- (const LaneVector <4, double>& a,
+                                         const LaneVector <4, double>& b)
+{
+  return LaneVector <4, double> (_mm256_sub_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, double> operator* (const LaneVector <4, double>& a,
+                                         const LaneVector <4, double>& b)
+{
+  return LaneVector <4, double> (_mm256_mul_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, double> operator/ (const LaneVector <4, double>& a,
+                                         const LaneVector <4, double>& b)
+{
+  return LaneVector <4, double> (_mm256_div_pd (a.m_v, b.m_v));
+}
+
+inline LaneVector <4, double> operator- (const LaneVector <4, double>& a)
+{
+  return LaneVector <4, double> (_mm256_xor_pd (a.m_v, _mm256_set1_pd (-0.)));
+}
+
+inline LaneVector <4, double> vectorSqrt (const LaneVector <4, double>& a)
+{
+  return LaneVector <4, double> (_mm256_sqrt_pd (a.m_v));
+}
+
+//------------------------------------------------------------------------------
+
+template <>
+struct LaneVector <8, float>
+{
+  enum
+  {
+    lanes = 8
+  };
+
+  LaneVector ()
+  {
+  }
+
+  explicit LaneVector (float v)
+    : m_v (_mm256_set1_ps (v))
+  {
+  }
+
+  explicit LaneVector (__m256 v)
+    : m_v (v)
+  {
+  }
+
+  float get (int lane) const
+  {
+    float v[8];
+    _mm256_storeu_ps (v, m_v);
+    return v[lane];
+  }
+
+  void set (int lane, float v)
+  {
+    float a[8];
+    _mm256_storeu_ps (a, m_v);
+    a[lane] = v;
+    m_v = _mm256_loadu_ps (a);
+  }
+
+  template <typename Sample>
+  void load (Sample* const* channels, int index)
+  {
+    m_v = _mm256_set_ps (static_cast<float> (channels[7][index]),
+                         static_cast<float> (channels[6][index]),
+                         static_cast<float> (channels[5][index]),
+                         static_cast<float> (channels[4][index]),
+                         static_cast<float> (channels[3][index]),
+                         static_cast<float> (channels[2][index]),
+                         static_cast<float> (channels[1][index]),
+                         static_cast<float> (channels[0][index]));
+  }
+
+  template <typename Sample>
+  void store (Sample* const* channels, int index) const
+  {
+    float v[8];
+    _mm256_storeu_ps (v, m_v);
+    for (int i = 0; i < 8; ++i)
+      channels[i][index] = static_cast<Sample> (v[i]);
+  }
+
+  // The lanes of an interleaved frame are adjacent
+  template <typename Sample>
+  void load (const InterleavedChannels <Sample>& channels, int index)
+  {
+    const Sample* p = channels.frame (index);
+    float v[8];
+    for (int i = 0; i < 8; ++i)
+      v[i] = static_cast<float> (p[i]);
+    m_v = _mm256_loadu_ps (v);
+  }
+
+  template <typename Sample>
+  void store (const InterleavedChannels <Sample>& channels, int index) const
+  {
+    float v[8];
+    _mm256_storeu_ps (v, m_v);
+    Sample* p = channels.frame (index);
+    for (int i = 0; i < 8; ++i)
+      p[i] = static_cast<Sample> (v[i]);
+  }
+
+  void load (const InterleavedChannels <float>& channels, int index)
+  {
+    m_v = _mm256_loadu_ps (channels.frame (index));
+  }
+
+  void store (const InterleavedChannels <float>& channels, int index) const
+  {
+    _mm256_storeu_ps (channels.frame (index), m_v);
+  }
+
+  float sum () const
+  {
+    float v[8];
+    _mm256_storeu_ps (v, m_v);
+    float r = v[0];
+    for (int i = 1; i < 8; ++i)
+      r += v[i];
+    return r;
+  }
+
+  __m256 m_v;
+};
+
+inline LaneVector <8, float> operator+ (const LaneVector <8, float>& a,
+                                        const LaneVector <8, float>& b)
+{
+  return LaneVector <8, float> (_mm256_add_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <8, float> operator- (const LaneVector <8, float>& a,
+                                        const LaneVector <8, float>& b)
+{
+  return LaneVector <8, float> (_mm256_sub_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <8, float> operator* (const LaneVector <8, float>& a,
+                                        const LaneVector <8, float>& b)
+{
+  return LaneVector <8, float> (_mm256_mul_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <8, float> operator/ (const LaneVector <8, float>& a,
+                                        const LaneVector <8, float>& b)
+{
+  return LaneVector <8, float> (_mm256_div_ps (a.m_v, b.m_v));
+}
+
+inline LaneVector <8, float> operator- (const LaneVector <8, float>& a)
+{
+  return LaneVector <8, float> (_mm256_xor_ps (a.m_v, _mm256_set1_ps (-0.f)));
+}
+
+inline LaneVector <8, float> vectorSqrt (const LaneVector <8, float>& a)
+{
+  return LaneVector <8, float> (_mm256_sqrt_ps (a.m_v));
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+
+// Realizations which provide a nested Lanes template for
+// processing several channels at once specialize this.
+template <class StateType>
+struct LaneTraits
+{
+  enum
+  {
+    supported = 0
+  };
+};
+
+enum
+{
+  // Widest group of channels processed in lock-step. Wider groups
+  // than the registers can hold just spill the state to memory.
+#if DSPFILTERS_AVX
+  maxLanes = 8,
+#else
+  maxLanes = 4,
+#endif
+
+  // Number of samples processed by each stage in turn
+  laneBlockSize = 64
+};
+
+// Widest group of channels processed in lock-step for the given
+// precision. A register holds twice as many float lanes as double.
+template <typename Value>
+struct LaneWidth
+{
+  enum
+  {
+    max = maxLanes
+  };
+};
+
+template <>
+struct LaneWidth <float>
+{
+  enum
+  {
+    max = 2 * maxLanes
+  };
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * Approximations of elementary functions built from nothing but the
+ * vector arithmetic, so they give the same results for a lane of any
+ * width and for LaneVector <1>. The arguments must be in the stated
+ * ranges, which cover what filter design needs, and the error bounds
+ * hold for double precision lanes.
+ *
+ */
+
+// Sine of u from -pi/2 to pi/2, from the Taylor series about zero.
+// The relative error is below 1e-15, so the result stays precise for
+// u near zero.
+template <class Vector>
+inline Vector vectorSin (const Vector& u)
+{
+  static const double sinSeries[] = {
+    1,
+    -0.16666666666666666,
+    0.0083333333333333332,
+    -0.00019841269841269841,
+    2.7557319223985893e-06,
+    -2.505210838544172e-08,
+    1.6059043836821613e-10,
+    -7.6471637318198164e-13,
+    2.8114572543455206e-15,
+    -8.2206352466243295e-18 };
+
+  const Vector u2 = u * u;
+
+  Vector s (sinSeries[9]);
+  for (int k = 8; k >= 0; --k)
+    s = s * u2 + Vector (sinSeries[k]);
+
+  return s * u;
+}
+
+// Cosine of u from -pi/2 to pi/2, from the Taylor series about zero.
+// The absolute error is below 1e-15.
+template <class Vector>
+inline Vector vectorCos (const Vector& u)
+{
+  static const double cosSeries[] = {
+    1,
+    -0.5,
+    0.041666666666666664,
+    -0.0013888888888888889,
+    2.4801587301587302e-05,
+    -2.7557319223985888e-07,
+    2.08767569878681e-09,
+    -1.1470745597729725e-11,
+    4.7794773323873853e-14,
+    -1.5619206968586225e-16,
+    4.1103176233121648e-19 };
+
+  const Vector u2 = u * u;
+
+  Vector c (cosSeries[10]);
+  for (int k = 9; k >= 0; --k)
+    c = c * u2 + Vector (cosSeries[k]);
+
+  return c;
+}
+
+// Sine and cosine of an angle from 0 to pi, from the Taylor series
+// about pi/2. The absolute error is below 1e-15.
+template <class Vector>
+inline void vectorSinCos (const Vector& angle, Vector& sine, Vector& cosine)
+{
+  const Vector u = angle - Vector (doublePi_2);
+
+  // sin (angle) = cos (u), cos (angle) = -sin (u)
+  sine = vectorCos (u);
+  cosine = -vectorSin (u);
+}
+
+// e to the power x, for x from -64 to 64. The series is summed for
+// x / 256 and the result squared eight times. The relative error is
+// below 1e-13.
+template <class Vector>
+inline Vector vectorExp (const Vector& x)
+{
+  const Vector one (1.);
+  const Vector y = x * Vector (1. / 256);
+
+  Vector e (one);
+  for (int k = 12; k >= 1; --k)
+    e = one + e * y * Vector (1. / k);
+
+  for (int i = 0; i < 8; ++i)
+    e = e * e;
+
+  return e;
+}
+
+// e to the power x, minus one, for x from -64 to 64. The same as
+// vectorExp, except that 1 + m is squared as m (m + 2), so the relative
+// error stays below 1e-13 for x near zero as well.
+template <class Vector>
+inline Vector vectorExpm1 (const Vector& x)
+{
+  const Vector one (1.), two (2.);
+  const Vector y = x * Vector (1. / 256);
+
+  Vector m (one);
+  for (int k = 12; k >= 2; --k)
+    m = one + m * y * Vector (1. / k);
+  m = m * y;
+
+  for (int i = 0; i < 8; ++i)
+    m = m * (m + two);
+
+  return m;
+}
+
+//------------------------------------------------------------------------------
+
+/*
+ * Puts the processor in flush to zero and denormals are zero mode
+ * for the lifetime of the object. Results too small for a normal
+ * number become zero and denormal inputs are read as zero, so a
+ * decaying tail never reaches the slow microcoded path. The previous
+ * mode is restored on destruction, which lets guards nest.
+ *
+ * Only the SSE control register is affected. Without SSE2 the
+ * guard does nothing.
+ *
+ */
+
+class ScopedFlushDenormals
+{
+public:
+#ifdef DSPFILTERS_SSE2
+  enum
+  {
+    flushToZero = 0x8000,
+    denormalsAreZero = 0x0040,
+    flushMask = flushToZero | denormalsAreZero
+  };
+
+  ScopedFlushDenormals ()
+    : m_csr (_mm_getcsr ())
+  {
+    // loading the register stalls the pipeline, skip it when possible
+    if ((m_csr & flushMask) != flushMask)
+      _mm_setcsr (m_csr | flushMask);
+  }
+
+  ~ScopedFlushDenormals ()
+  {
+    if ((m_csr & flushMask) != flushMask)
+      _mm_setcsr (m_csr);
+  }
+
+private:
+  ScopedFlushDenormals (const ScopedFlushDenormals&);
+  ScopedFlushDenormals& operator= (const ScopedFlushDenormals&);
+
+private:
+  unsigned int m_csr;
+#else
+  ScopedFlushDenormals ()
+  {
+  }
+#endif
+};
+
+// Held by the library for the duration of each call to process.
+#ifdef DSPFILTERS_FLUSH_DENORMALS
+typedef ScopedFlushDenormals DenormalGuard;
+#else
+struct DenormalGuard
+{
+  DenormalGuard ()
+  {
+  }
+};
+#endif
+
+}
+
+#endif
@@ -41,6 +41,13 @@ namespace Dsp {
 /*
  * Implements smooth modulation of time-varying filter parameters
  *
+ * By default the filter is redesigned at every sample of a transition.
+ * With a control interval of more than one sample, it is only designed
+ * at the start and end of each interval, and the coefficients of its
+ * stages are interpolated in between. This is far cheaper for high
+ * order pole filters. An interval at least as long as the transition
+ * designs only the two endpoints.
+ *
  */
 template <class DesignClass,
           int Channels,
@@ -53,16 +60,114 @@ class SmoothedFilterDesign
 public:
   typedef FilterDesign <DesignClass, Channels, StateType> filter_type_t;
 
-  SmoothedFilterDesign (int transitionSamples)
+  SmoothedFilterDesign (int transitionSamples, int controlInterval = 1)
     : m_transitionSamples (transitionSamples)
+    , m_controlInterval (controlInterval)
     , m_remainingSamples (-1) // first time flag
+    , m_segmentFrom (0)
+    , m_segmentLength (0)
+    , m_segmentPosition (0)
+  {
+    assert (controlInterval >= 1);
+  }
+
+  // Number of samples between redesigns during a transition
+  void setControlInterval (int controlInterval)
+  {
+    assert (controlInterval >= 1);
+    interruptSegment ();
+    m_controlInterval = controlInterval;
+  }
+
+  int getControlInterval () const
   {
+    return m_controlInterval;
   }
 
   // Process a block of samples.
   template <typename Sample>
   void processBlock (int numSamples,
                      Sample* const* destChannelArray)
+  {
+    DenormalGuard guard;
+
+    const int remainingSamples = processTransition (numSamples,
+                                                    destChannelArray);
+
+    // do what's left
+    if (numSamples - remainingSamples > 0)
+    {
+      // no transition
+      Sample* dest[Channels];
+      for (int i = 0; i < this->getNumChannels(); ++i)
+        dest[i] = destChannelArray[i] + remainingSamples;
+
+      this->m_state.process (numSamples - remainingSamples,
+                             dest,
+                             this->m_design);
+    }
+  }
+
+  // Process a block of interleaved frames.
+  template <typename Sample>
+  void processInterleavedBlock (int numFrames, Sample* data)
+  {
+    DenormalGuard guard;
+
+    const InterleavedChannels <Sample> channels (data, this->getNumChannels());
+
+    const int remainingFrames = processTransition (numFrames, channels);
+
+    if (numFrames - remainingFrames > 0)
+      this->m_state.processInterleaved (numFrames - remainingFrames,
+                                        channels.frame (remainingFrames),
+                                        this->m_design);
+  }
+
+  void process (int numSamples, float* const* arrayOfChannels)
+  {
+    processBlock (numSamples, arrayOfChannels);
+  }
+
+  void process (int numSamples, double* const* arrayOfChannels)
+  {
+    processBlock (numSamples, arrayOfChannels);
+  }
+
+  void processInterleaved (int numFrames, int numChannels, float* data)
+  {
+    if (numChannels != this->getNumChannels())
+      throw std::logic_error ("wrong number of interleaved channels");
+    processInterleavedBlock (numFrames, data);
+  }
+
+  void processInterleaved (int numFrames, int numChannels, double* data)
+  {
+    if (numChannels != this->getNumChannels())
+      throw std::logic_error ("wrong number of interleaved channels");
+    processInterleavedBlock (numFrames, data);
+  }
+
+protected:
+  template <typename Sample>
+  static Sample& sampleAt (Sample* const* channels, int channel, int index)
+  {
+    return channels[channel][index];
+  }
+
+  template <typename Sample>
+  static Sample& sampleAt (const InterleavedChannels <Sample>& channels,
+                           int channel,
+                           int index)
+  {
+    return channels.at (channel, index);
+  }
+
+  // Processes the samples at the start of a block which are still part
+  // of a transition, and returns how many there were.
+  template <class ChannelArray>
+  int processTransition (int numSamples,
+                         const ChannelArray& destChannelArray)
   {
     const int numChannels = this->getNumChannels();
 
@@ -72,9 +177,40 @@ public:
     // first handle any transition samples
     int remainingSamples = std::min (m_remainingSamples, numSamples);
 
-    if (remainingSamples > 0)
+    if (remainingSamples > 0 && m_controlInterval > 1)
+    {
+      // interpolate coefficients between designs at the control points
+      for (int n = 0; n < remainingSamples;)
+      {
+        if (m_segmentPosition == m_segmentLength)
+          beginSegment (m_remainingSamples - n);
+
+        const DesignClass& from = m_segmentFilter[m_segmentFrom];
+        const DesignClass& to = m_segmentFilter[1 - m_segmentFrom];
+        const double t = 1. / m_segmentLength;
+        const int count = std::min (m_segmentLength - m_segmentPosition,
+                                    remainingSamples - n);
+
+        for (int end = n + count; n < end; ++n)
+        {
+          m_transitionFilter.interpolate (from, to, ++m_segmentPosition * t);
+
+          for (int i = numChannels; --i >= 0;)
+            sampleAt (destChannelArray, i, n) = this->m_state[i].process (
+              sampleAt (destChannelArray, i, n), m_transitionFilter);
+        }
+      }
+
+      m_remainingSamples -= remainingSamples;
+
+      if (m_remainingSamples == 0)
+        m_transitionParams = this->getParams();
+    }
+    else if (remainingSamples > 0)
     {
       // interpolate parameters for each sample
+      interruptSegment ();
+
       const double t = 1. / m_remainingSamples;
       double dp[maxParameters];
       for (int i = 0; i < DesignClass::NumParams; ++i)
@@ -88,10 +224,8 @@ public:
         m_transitionFilter.setParams (m_transitionParams);
         
         for (int i = numChannels; --i >= 0;)
-        {
-          Sample* dest = destChannelArray[i]+n;
-          *dest = this->m_state[i].process (*dest, m_transitionFilter);
-        }
+          sampleAt (destChannelArray, i, n) = this->m_state[i].process (
+            sampleAt (destChannelArray, i, n), m_transitionFilter);
       }
 
       m_remainingSamples -= remainingSamples;
@@ -100,32 +234,18 @@ public:
         m_transitionParams = this->getParams();
     }
 
-    // do what's left
-    if (numSamples - remainingSamples > 0)
-    {
-      // no transition
-      for (int i = 0; i < numChannels; ++i)
-        this->m_design.process (numSamples - remainingSamples,
-                          destChannelArray[i] + remainingSamples,
-                          this->m_state[i]);
-    }
-  }
-
-  void process (int numSamples, float* const* arrayOfChannels)
-  {
-    processBlock (numSamples, arrayOfChannels);
-  }
-
-  void process (int numSamples, double* const* arrayOfChannels)
-  {
-    processBlock (numSamples, arrayOfChannels);
+    return remainingSamples;
   }
 
-protected:
   void doSetParams (const Params& parameters)
   {
     if (m_remainingSamples >= 0)
     {
+      // a change in the middle of a control interval starts
+      // the next one from where the parameters are now
+      if (m_segmentPosition < m_segmentLength)
+        interruptSegment ();
+
       m_remainingSamples = m_transitionSamples;
     }
     else
@@ -138,12 +258,75 @@ protected:
     filter_type_t::doSetParams (parameters);
   }
 
+private:
+  // Leaves the current control interval. The next one starts over
+  // from where the parameters are now.
+  void interruptSegment ()
+  {
+    if (m_segmentPosition == m_segmentLength)
+    {
+      if (m_segmentLength > 0)
+        m_transitionParams = m_segmentParams;
+    }
+    else
+    {
+      const double t = double (m_segmentPosition) / m_segmentLength;
+      for (int i = 0; i < DesignClass::NumParams; ++i)
+        m_transitionParams[i] += (m_segmentParams[i] - m_transitionParams[i]) * t;
+    }
+
+    m_segmentLength = 0;
+    m_segmentPosition = 0;
+  }
+
+  // Designs the end of the next control interval. The end of the
+  // previous interval becomes the start, so only one design is
+  // needed unless the transition was interrupted.
+  void beginSegment (int remainingSamples)
+  {
+    if (m_segmentLength == 0)
+    {
+      m_segmentFilter[m_segmentFrom].setParams (m_transitionParams);
+    }
+    else
+    {
+      m_segmentFrom = 1 - m_segmentFrom;
+      m_transitionParams = m_segmentParams;
+    }
+
+    m_segmentLength = std::min (m_controlInterval, remainingSamples);
+    m_segmentPosition = 0;
+
+    if (m_segmentLength < remainingSamples)
+    {
+      const double t = double (m_segmentLength) / remainingSamples;
+      m_segmentParams = m_transitionParams;
+      for (int i = 0; i < DesignClass::NumParams; ++i)
+        m_segmentParams[i] += (this->getParams()[i] - m_transitionParams[i]) * t;
+    }
+    else
+    {
+      // the last interval ends exactly on the new design
+      m_segmentParams = this->getParams();
+    }
+
+    m_segmentFilter[1 - m_segmentFrom].setParams (m_segmentParams);
+  }
+
 protected:
   Params m_transitionParams;
   DesignClass m_transitionFilter;
   int m_transitionSamples;
+  int m_controlInterval;
 
   int m_remainingSamples;        // remaining transition samples
+
+  // designs at the start and end of the current control interval
+  DesignClass m_segmentFilter[2];
+  Params m_segmentParams;
+  int m_segmentFrom;
+  int m_segmentLength;
+  int m_segmentPosition;
 };
 
 }
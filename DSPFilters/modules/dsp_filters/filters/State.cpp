@@ -37,4 +37,32 @@ namespace Dsp {
 
 //------------------------------------------------------------------------------
 
+StateArena::StateArena ()
+  : m_block (0)
+{
+}
+
+StateArena::~StateArena ()
+{
+  free ();
+}
+
+void* StateArena::allocate (size_t bytes)
+{
+  free ();
+
+  m_block = new char [bytes + alignment - 1];
+
+  const size_t address = reinterpret_cast<size_t> (m_block);
+  return m_block + ((alignment - address % alignment) % alignment);
+}
+
+void StateArena::free ()
+{
+  delete[] m_block;
+  m_block = 0;
+}
+
+//------------------------------------------------------------------------------
+
 }
@@ -53,11 +53,18 @@ namespace Dsp {
  *
  *  y[n] = (b0/a0)*x[n] + (b1/a0)*x[n-1] + (b2/a0)*x[n-2]
  *                      - (a1/a0)*y[n-1] - (a2/a0)*y[n-2]  
+ *
+ * Each realization is a template on the precision of its state and
+ * arithmetic. The names without the Basic prefix use double.
  */
-class DirectFormI
+template <typename Value>
+class BasicDirectFormI
 {
 public:
-  DirectFormI ()
+  typedef Value value_t;
+  typedef typename CoefficientPrecision <Value>::type coefficient_t;
+
+  BasicDirectFormI ()
   {
     reset();
   }
@@ -70,29 +77,110 @@ public:
     m_y2 = 0;
   }
 
-  template <typename Sample>
+  // Puts the state where a constant input would have settled it,
+  // and returns the output it settled to.
+  template <typename Coefficient>
+  Value setSteadyState (const Value in,
+                        const BiquadCoefficients <Coefficient>& s)
+  {
+    const Value out = in * Value(s.m_b0 + s.m_b1 + s.m_b2) /
+                           Value(1 + s.m_a1 + s.m_a2);
+    m_x1 = m_x2 = in;
+    m_y1 = m_y2 = out;
+    return out;
+  }
+
+  template <typename Sample, typename Coefficient>
   inline Sample process1 (const Sample in,
-                          const BiquadBase& s,
-                          const double vsa) // very small amount
+                          const BiquadCoefficients <Coefficient>& s,
+                          const Value vsa) // very small amount
   {
-    double out = s.m_b0*in + s.m_b1*m_x1 + s.m_b2*m_x2
-                           - s.m_a1*m_y1 - s.m_a2*m_y2
-                           + vsa;
+    const Value x = static_cast<Value> (in);
+    Value out = add_denormal_offset (
+      Value(s.m_b0)*x + Value(s.m_b1)*m_x1 + Value(s.m_b2)*m_x2
+                      - Value(s.m_a1)*m_y1 - Value(s.m_a2)*m_y2, vsa);
     m_x2 = m_x1;
     m_y2 = m_y1;
-    m_x1 = in;
+    m_x1 = x;
     m_y1 = out;
 
     return static_cast<Sample> (out);
   }
 
+  // State for several channels processed in lock-step
+  template <class Vector>
+  class Lanes
+  {
+  public:
+    Lanes ()
+      : m_a1 (Value(0)), m_a2 (Value(0))
+      , m_b0 (Value(0)), m_b1 (Value(0)), m_b2 (Value(0))
+      , m_x2 (Value(0)), m_y2 (Value(0)), m_x1 (Value(0)), m_y1 (Value(0))
+    {
+    }
+
+    template <typename Coefficient>
+    explicit Lanes (const BiquadCoefficients <Coefficient>& s)
+      : m_a1 (Value(s.m_a1)), m_a2 (Value(s.m_a2))
+      , m_b0 (Value(s.m_b0)), m_b1 (Value(s.m_b1)), m_b2 (Value(s.m_b2))
+      , m_x2 (Value(0)), m_y2 (Value(0)), m_x1 (Value(0)), m_y1 (Value(0))
+    {
+    }
+
+    // Gives one lane coefficients of its own
+    template <typename Coefficient>
+    void setCoefficients (int lane, const BiquadCoefficients <Coefficient>& s)
+    {
+      m_a1.set (lane, Value(s.m_a1));
+      m_a2.set (lane, Value(s.m_a2));
+      m_b0.set (lane, Value(s.m_b0));
+      m_b1.set (lane, Value(s.m_b1));
+      m_b2.set (lane, Value(s.m_b2));
+    }
+
+    void load (int lane, const BasicDirectFormI& state)
+    {
+      m_x1.set (lane, state.m_x1);
+      m_x2.set (lane, state.m_x2);
+      m_y1.set (lane, state.m_y1);
+      m_y2.set (lane, state.m_y2);
+    }
+
+    void store (int lane, BasicDirectFormI& state) const
+    {
+      state.m_x1 = m_x1.get (lane);
+      state.m_x2 = m_x2.get (lane);
+      state.m_y1 = m_y1.get (lane);
+      state.m_y2 = m_y2.get (lane);
+    }
+
+    inline Vector process1 (const Vector& in, const Vector& vsa)
+    {
+      Vector out = add_denormal_offset (
+        m_b0*in + m_b1*m_x1 + m_b2*m_x2
+                - m_a1*m_y1 - m_a2*m_y2, vsa);
+      m_x2 = m_x1;
+      m_y2 = m_y1;
+      m_x1 = in;
+      m_y1 = out;
+
+      return out;
+    }
+
+  private:
+    Vector m_a1, m_a2, m_b0, m_b1, m_b2;
+    Vector m_x2, m_y2, m_x1, m_y1;
+  };
+
 protected:
-  double m_x2; // x[n-2]
-  double m_y2; // y[n-2]
-  double m_x1; // x[n-1]
-  double m_y1; // y[n-1]
+  Value m_x2; // x[n-2]
+  Value m_y2; // y[n-2]
+  Value m_x1; // x[n-1]
+  Value m_y1; // y[n-1]
 };
 
+typedef BasicDirectFormI <double> DirectFormI;
+
 //------------------------------------------------------------------------------
 
 /*
@@ -104,10 +192,14 @@ protected:
  *  y(n) = (b0/a0)*v[n] + (b1/a0)*v[n-1] + (b2/a0)*v[n-2]
  *
  */
-class DirectFormII
+template <typename Value>
+class BasicDirectFormII
 {
 public:
-  DirectFormII ()
+  typedef Value value_t;
+  typedef typename CoefficientPrecision <Value>::type coefficient_t;
+
+  BasicDirectFormII ()
   {
     reset ();
   }
@@ -118,13 +210,25 @@ public:
     m_v2 = 0;
   }
 
-  template <typename Sample>
+  // Puts the state where a constant input would have settled it,
+  // and returns the output it settled to.
+  template <typename Coefficient>
+  Value setSteadyState (const Value in,
+                        const BiquadCoefficients <Coefficient>& s)
+  {
+    const Value w = in / Value(1 + s.m_a1 + s.m_a2);
+    m_v1 = m_v2 = w;
+    return Value(s.m_b0 + s.m_b1 + s.m_b2) * w;
+  }
+
+  template <typename Sample, typename Coefficient>
   Sample process1 (const Sample in,
-                   const BiquadBase& s,
-                   const double vsa)
+                   const BiquadCoefficients <Coefficient>& s,
+                   const Value vsa)
   {
-    double w   = in - s.m_a1*m_v1 - s.m_a2*m_v2 + vsa;
-    double out =      s.m_b0*w    + s.m_b1*m_v1 + s.m_b2*m_v2;
+    Value w   = add_denormal_offset (
+      static_cast<Value> (in) - Value(s.m_a1)*m_v1 - Value(s.m_a2)*m_v2, vsa);
+    Value out =      Value(s.m_b0)*w    + Value(s.m_b1)*m_v1 + Value(s.m_b2)*m_v2;
 
     m_v2 = m_v1;
     m_v1 = w;
@@ -132,11 +236,72 @@ public:
     return static_cast<Sample> (out);
   }
 
+  // State for several channels processed in lock-step
+  template <class Vector>
+  class Lanes
+  {
+  public:
+    Lanes ()
+      : m_a1 (Value(0)), m_a2 (Value(0))
+      , m_b0 (Value(0)), m_b1 (Value(0)), m_b2 (Value(0))
+      , m_v1 (Value(0)), m_v2 (Value(0))
+    {
+    }
+
+    template <typename Coefficient>
+    explicit Lanes (const BiquadCoefficients <Coefficient>& s)
+      : m_a1 (Value(s.m_a1)), m_a2 (Value(s.m_a2))
+      , m_b0 (Value(s.m_b0)), m_b1 (Value(s.m_b1)), m_b2 (Value(s.m_b2))
+      , m_v1 (Value(0)), m_v2 (Value(0))
+    {
+    }
+
+    // Gives one lane coefficients of its own
+    template <typename Coefficient>
+    void setCoefficients (int lane, const BiquadCoefficients <Coefficient>& s)
+    {
+      m_a1.set (lane, Value(s.m_a1));
+      m_a2.set (lane, Value(s.m_a2));
+      m_b0.set (lane, Value(s.m_b0));
+      m_b1.set (lane, Value(s.m_b1));
+      m_b2.set (lane, Value(s.m_b2));
+    }
+
+    void load (int lane, const BasicDirectFormII& state)
+    {
+      m_v1.set (lane, state.m_v1);
+      m_v2.set (lane, state.m_v2);
+    }
+
+    void store (int lane, BasicDirectFormII& state) const
+    {
+      state.m_v1 = m_v1.get (lane);
+      state.m_v2 = m_v2.get (lane);
+    }
+
+    inline Vector process1 (const Vector& in, const Vector& vsa)
+    {
+      Vector w   = add_denormal_offset (in - m_a1*m_v1 - m_a2*m_v2, vsa);
+      Vector out =      m_b0*w    + m_b1*m_v1 + m_b2*m_v2;
+
+      m_v2 = m_v1;
+      m_v1 = w;
+
+      return out;
+    }
+
+  private:
+    Vector m_a1, m_a2, m_b0, m_b1, m_b2;
+    Vector m_v1, m_v2;
+  };
+
 private:
-  double m_v1; // v[-1]
-  double m_v2; // v[-2]
+  Value m_v1; // v[-1]
+  Value m_v2; // v[-2]
 };
 
+typedef BasicDirectFormII <double> DirectFormII;
+
 //------------------------------------------------------------------------------
 
 /*
@@ -149,10 +314,14 @@ private:
  */
 
 // I think this one is broken
-class TransposedDirectFormI
+template <typename Value>
+class BasicTransposedDirectFormI
 {
 public:
-  TransposedDirectFormI ()
+  typedef Value value_t;
+  typedef typename CoefficientPrecision <Value>::type coefficient_t;
+
+  BasicTransposedDirectFormI ()
   {
     reset ();
   }
@@ -170,20 +339,34 @@ public:
     m_s4_1 = 0;
   }
 
-  template <typename Sample>
+  // Puts the state where a constant input would have settled it,
+  // and returns the output it settled to.
+  template <typename Coefficient>
+  Value setSteadyState (const Value in,
+                        const BiquadCoefficients <Coefficient>& s)
+  {
+    m_v = in / Value(1 + s.m_a1 + s.m_a2);
+    m_s1 = m_s1_1 = -Value(s.m_a1 + s.m_a2) * m_v;
+    m_s2 = m_s2_1 = -Value(s.m_a2) * m_v;
+    m_s4 = m_s4_1 = Value(s.m_b2) * m_v;
+    m_s3 = m_s3_1 = Value(s.m_b1) * m_v + m_s4;
+    return Value(s.m_b0) * m_v + m_s3;
+  }
+
+  template <typename Sample, typename Coefficient>
   inline Sample process1 (const Sample in,
-                          const BiquadBase& s,
-                          const double vsa)
+                          const BiquadCoefficients <Coefficient>& s,
+                          const Value)
   {
-    double out;
+    Value out;
 
     // can be: in += m_s1_1;
-    m_v = in + m_s1_1;
-    out = s.m_b0*m_v + m_s3_1;
-    m_s1 = m_s2_1 - s.m_a1*m_v;
-    m_s2 = -s.m_a2*m_v;
-    m_s3 = s.m_b1*m_v + m_s4_1;
-    m_s4 = s.m_b2*m_v; 
+    m_v = static_cast<Value> (in) + m_s1_1;
+    out = Value(s.m_b0)*m_v + m_s3_1;
+    m_s1 = m_s2_1 - Value(s.m_a1)*m_v;
+    m_s2 = -Value(s.m_a2)*m_v;
+    m_s3 = Value(s.m_b1)*m_v + m_s4_1;
+    m_s4 = Value(s.m_b2)*m_v; 
 
     m_s4_1 = m_s4;
     m_s3_1 = m_s3;
@@ -194,23 +377,29 @@ public:
   }
 
 private:
-  double m_v;
-  double m_s1;
-  double m_s1_1;
-  double m_s2;
-  double m_s2_1;
-  double m_s3;
-  double m_s3_1;
-  double m_s4;
-  double m_s4_1;
+  Value m_v;
+  Value m_s1;
+  Value m_s1_1;
+  Value m_s2;
+  Value m_s2_1;
+  Value m_s3;
+  Value m_s3_1;
+  Value m_s4;
+  Value m_s4_1;
 };
 
+typedef BasicTransposedDirectFormI <double> TransposedDirectFormI;
+
 //------------------------------------------------------------------------------
 
-class TransposedDirectFormII
+template <typename Value>
+class BasicTransposedDirectFormII
 {
 public:
-  TransposedDirectFormII ()
+  typedef Value value_t;
+  typedef typename CoefficientPrecision <Value>::type coefficient_t;
+
+  BasicTransposedDirectFormII ()
   {
     reset ();
   }
@@ -223,29 +412,310 @@ public:
     m_s2_1 = 0;
   }
 
-  template <typename Sample>
+  // Puts the state where a constant input would have settled it,
+  // and returns the output it settled to.
+  template <typename Coefficient>
+  Value setSteadyState (const Value in,
+                        const BiquadCoefficients <Coefficient>& s)
+  {
+    const Value out = in * Value(s.m_b0 + s.m_b1 + s.m_b2) /
+                           Value(1 + s.m_a1 + s.m_a2);
+    m_s2 = m_s2_1 = Value(s.m_b2)*in - Value(s.m_a2)*out;
+    m_s1 = m_s1_1 = out - Value(s.m_b0)*in;
+    return out;
+  }
+
+  template <typename Sample, typename Coefficient>
   inline Sample process1 (const Sample in,
-                          const BiquadBase& s,
-                          const double vsa)
+                          const BiquadCoefficients <Coefficient>& s,
+                          const Value vsa)
   {
-    double out;
+    const Value x = static_cast<Value> (in);
+    Value out;
 
-    out = m_s1_1 + s.m_b0*in + vsa;
-    m_s1 = m_s2_1 + s.m_b1*in - s.m_a1*out;
-    m_s2 = s.m_b2*in - s.m_a2*out;
+    out = add_denormal_offset (m_s1_1 + Value(s.m_b0)*x, vsa);
+    m_s1 = m_s2_1 + Value(s.m_b1)*x - Value(s.m_a1)*out;
+    m_s2 = Value(s.m_b2)*x - Value(s.m_a2)*out;
     m_s1_1 = m_s1;
     m_s2_1 = m_s2;
 
     return static_cast<Sample> (out);
   }
 
+  // State for several channels processed in lock-step
+  template <class Vector>
+  class Lanes
+  {
+  public:
+    Lanes ()
+      : m_a1 (Value(0)), m_a2 (Value(0))
+      , m_b0 (Value(0)), m_b1 (Value(0)), m_b2 (Value(0))
+      , m_s1_1 (Value(0)), m_s2_1 (Value(0))
+    {
+    }
+
+    template <typename Coefficient>
+    explicit Lanes (const BiquadCoefficients <Coefficient>& s)
+      : m_a1 (Value(s.m_a1)), m_a2 (Value(s.m_a2))
+      , m_b0 (Value(s.m_b0)), m_b1 (Value(s.m_b1)), m_b2 (Value(s.m_b2))
+      , m_s1_1 (Value(0)), m_s2_1 (Value(0))
+    {
+    }
+
+    // Gives one lane coefficients of its own
+    template <typename Coefficient>
+    void setCoefficients (int lane, const BiquadCoefficients <Coefficient>& s)
+    {
+      m_a1.set (lane, Value(s.m_a1));
+      m_a2.set (lane, Value(s.m_a2));
+      m_b0.set (lane, Value(s.m_b0));
+      m_b1.set (lane, Value(s.m_b1));
+      m_b2.set (lane, Value(s.m_b2));
+    }
+
+    void load (int lane, const BasicTransposedDirectFormII& state)
+    {
+      m_s1_1.set (lane, state.m_s1_1);
+      m_s2_1.set (lane, state.m_s2_1);
+    }
+
+    void store (int lane, BasicTransposedDirectFormII& state) const
+    {
+      state.m_s1 = state.m_s1_1 = m_s1_1.get (lane);
+      state.m_s2 = state.m_s2_1 = m_s2_1.get (lane);
+    }
+
+    inline Vector process1 (const Vector& in, const Vector& vsa)
+    {
+      Vector out = add_denormal_offset (m_s1_1 + m_b0*in, vsa);
+      m_s1_1 = m_s2_1 + m_b1*in - m_a1*out;
+      m_s2_1 = m_b2*in - m_a2*out;
+
+      return out;
+    }
+
+  private:
+    Vector m_a1, m_a2, m_b0, m_b1, m_b2;
+    Vector m_s1_1, m_s2_1;
+  };
+
 private:
-  double m_s1;
-  double m_s1_1;
-  double m_s2;
-  double m_s2_1;
+  Value m_s1;
+  Value m_s1_1;
+  Value m_s2;
+  Value m_s2_1;
 };
 
+typedef BasicTransposedDirectFormII <double> TransposedDirectFormII;
+
+//------------------------------------------------------------------------------
+
+// These realizations provide Lanes
+template <typename Value>
+struct LaneTraits <BasicDirectFormI <Value> >
+{
+  enum { supported = 1 };
+};
+
+template <typename Value>
+struct LaneTraits <BasicDirectFormII <Value> >
+{
+  enum { supported = 1 };
+};
+
+template <typename Value>
+struct LaneTraits <BasicTransposedDirectFormII <Value> >
+{
+  enum { supported = 1 };
+};
+
+// Splits channels into groups which are processed in lock-step.
+// The channels are an array of channel pointers or InterleavedChannels.
+// Returns the number of channels processed, the caller is
+// responsible for the remainder.
+template <bool Supported>
+struct ChannelLanes
+{
+  template <class DesignState, class Filter, class Channels>
+  static int process (int,
+                      int,
+                      const Channels&,
+                      DesignState*,
+                      const Filter&)
+  {
+    return 0;
+  }
+};
+
+template <>
+struct ChannelLanes <true>
+{
+  template <class DesignState, class Filter, class Channels>
+  static int process (int numSamples,
+                      int numChannels,
+                      const Channels& arrayOfChannels,
+                      DesignState* states,
+                      const Filter& filter)
+  {
+    typedef typename DesignState::value_t value_t;
+
+    int i = 0;
+
+    if (LaneWidth <value_t>::max >= 16)
+    {
+      for (; i + 16 <= numChannels; i += 16)
+        DesignState::template processLanes <LaneVector <16, value_t> > (
+          numSamples, arrayOfChannels + i, states + i, filter);
+    }
+
+    if (LaneWidth <value_t>::max >= 8)
+    {
+      for (; i + 8 <= numChannels; i += 8)
+        DesignState::template processLanes <LaneVector <8, value_t> > (
+          numSamples, arrayOfChannels + i, states + i, filter);
+    }
+
+    for (; i + 4 <= numChannels; i += 4)
+      DesignState::template processLanes <LaneVector <4, value_t> > (
+        numSamples, arrayOfChannels + i, states + i, filter);
+
+    for (; i + 2 <= numChannels; i += 2)
+      DesignState::template processLanes <LaneVector <2, value_t> > (
+        numSamples, arrayOfChannels + i, states + i, filter);
+
+    return i;
+  }
+};
+
+// Filters planar channels. Every channel uses the same coefficients,
+// so groups of channels can run in lock-step.
+template <class DesignState, class Filter, typename Sample>
+void processChannels (int numSamples,
+                      int numChannels,
+                      Sample* const* arrayOfChannels,
+                      DesignState* states,
+                      Filter& filter)
+{
+  int i = ChannelLanes <DesignState::supportsLanes>::process (
+    numSamples, numChannels, arrayOfChannels, states, filter);
+
+  for (; i < numChannels; ++i)
+    filter.process (numSamples, arrayOfChannels[i], states[i]);
+}
+
+// Filters a share of the channels on each thread of a WorkerPool.
+// The shares are made of whole groups of lanes.
+template <class DesignState, class Filter, typename Sample>
+class ChannelsTask : public WorkerPool::Task
+{
+public:
+  enum
+  {
+    groupSize = LaneWidth <typename DesignState::value_t>::max
+  };
+
+  ChannelsTask (int numSamples,
+                int numChannels,
+                Sample* const* arrayOfChannels,
+                DesignState* states,
+                Filter& filter,
+                int numParts)
+    : m_numSamples (numSamples)
+    , m_numChannels (numChannels)
+    , m_arrayOfChannels (arrayOfChannels)
+    , m_states (states)
+    , m_filter (filter)
+    , m_numParts (numParts)
+  {
+  }
+
+  // Fewer channels than a group are not worth another thread
+  static int getNumParts (const WorkerPool& pool, int numChannels)
+  {
+    return std::min (pool.getNumWorkers () + 1, numChannels / int (groupSize));
+  }
+
+  void run (int part)
+  {
+    // each thread has a mode of its own
+    DenormalGuard guard;
+
+    const int numGroups = (m_numChannels + groupSize - 1) / groupSize;
+    const int first = std::min (m_numChannels,
+                                numGroups * part / m_numParts * groupSize);
+    const int last = std::min (m_numChannels,
+                               numGroups * (part + 1) / m_numParts * groupSize);
+
+    processChannels (m_numSamples, last - first, m_arrayOfChannels + first,
+                     m_states + first, m_filter);
+  }
+
+private:
+  int m_numSamples;
+  int m_numChannels;
+  Sample* const* m_arrayOfChannels;
+  DesignState* m_states;
+  Filter& m_filter;
+  int m_numParts;
+};
+
+// Spreads the channels over the threads of the pool, if there is one
+template <class DesignState, class Filter, typename Sample>
+void processChannels (int numSamples,
+                      int numChannels,
+                      Sample* const* arrayOfChannels,
+                      DesignState* states,
+                      Filter& filter,
+                      WorkerPool* pool)
+{
+  typedef ChannelsTask <DesignState, Filter, Sample> task_t;
+
+  const int numParts = pool ? task_t::getNumParts (*pool, numChannels) : 1;
+
+  if (numParts > 1)
+  {
+    task_t task (numSamples, numChannels, arrayOfChannels, states, filter,
+                 numParts);
+    pool->run (task, numParts);
+  }
+  else
+  {
+    processChannels (numSamples, numChannels, arrayOfChannels, states, filter);
+  }
+}
+
+// Filters interleaved frames in place. Groups of channels are loaded
+// into the lanes straight from the frames, any other channel is
+// copied out and back a block at a time.
+template <class DesignState, class Filter, typename Sample>
+void processInterleaved (int numFrames,
+                         int numChannels,
+                         Sample* data,
+                         DesignState* states,
+                         Filter& filter)
+{
+  const InterleavedChannels <Sample> channels (data, numChannels);
+
+  int i = ChannelLanes <DesignState::supportsLanes>::process (
+    numFrames, numChannels, channels, states, filter);
+
+  const int blockSize = laneBlockSize;
+  Sample buf [blockSize];
+
+  for (; i < numChannels; ++i)
+  {
+    for (int offset = 0; offset < numFrames; offset += blockSize)
+    {
+      const int n = std::min (numFrames - offset, blockSize);
+      for (int j = 0; j < n; ++j)
+        buf[j] = channels.at (i, offset + j);
+      filter.process (n, buf, states[i]);
+      for (int j = 0; j < n; ++j)
+        channels.at (i, offset + j) = buf[j];
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 
 // Holds an array of states suitable for multi-channel processing
@@ -254,14 +724,27 @@ class ChannelsState
 {
 public:
   ChannelsState ()
+    : m_pool (0)
   {
   }
 
-  const int getNumChannels() const
+  int getNumChannels() const
   {
     return Channels;
   }
 
+  // Planar channels are spread over the threads of the pool.
+  // Zero processes them all on the calling thread.
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_pool = pool;
+  }
+
+  WorkerPool* getWorkerPool () const
+  {
+    return m_pool;
+  }
+
   void reset ()
   {
     for (int i = 0; i < Channels; ++i)
@@ -279,12 +762,208 @@ public:
                 Sample* const* arrayOfChannels,
                 Filter& filter)
   {
-    for (int i = 0; i < Channels; ++i)
-      filter.process (numSamples, arrayOfChannels[i], m_state[i]);
+    DenormalGuard guard;
+
+    processChannels (numSamples, Channels, arrayOfChannels, m_state, filter,
+                     m_pool);
+  }
+
+  template <class Filter, typename Sample>
+  void processInterleaved (int numFrames,
+                           Sample* data,
+                           Filter& filter)
+  {
+    DenormalGuard guard;
+
+    Dsp::processInterleaved (numFrames, Channels, data, m_state, filter);
   }
 
 private:
   StateType m_state[Channels];
+  WorkerPool* m_pool;
+};
+
+// Channel count for a ChannelsState whose number of channels
+// is chosen at run time with setNumChannels().
+enum
+{
+  dynamicChannels = -1
+};
+
+// Raw storage for the states of a run-time number of channels.
+// The block starts on a cache line, so that the states of a group
+// of channels which are processed together share as few lines as
+// possible with anything else.
+class StateArena
+{
+public:
+  enum
+  {
+    alignment = 64
+  };
+
+  StateArena ();
+  ~StateArena ();
+
+  // Frees the previous block
+  void* allocate (size_t bytes);
+  void free ();
+
+private:
+  StateArena (const StateArena&);
+  StateArena& operator= (const StateArena&);
+
+private:
+  char* m_block;
+};
+
+// A state followed by enough padding that each one in an array
+// aligned to a cache line starts on a line of its own.
+template <class StateType,
+          int Padding = (StateArena::alignment -
+                         sizeof (StateType) % StateArena::alignment) %
+                        StateArena::alignment>
+struct PaddedState : StateType
+{
+  char m_padding [Padding];
+};
+
+template <class StateType>
+struct PaddedState <StateType, 0> : StateType
+{
+};
+
+// State for any number of channels, kept contiguous in one
+// arena. Changing the number of channels allocates memory,
+// processing does not. No two channels share a cache line, so
+// threads of a WorkerPool never write to the same line.
+template <class StateType>
+class ChannelsState <dynamicChannels, StateType>
+{
+public:
+  ChannelsState ()
+    : m_numChannels (0)
+    , m_state (0)
+    , m_pool (0)
+  {
+  }
+
+  ChannelsState (const ChannelsState& other)
+    : m_numChannels (0)
+    , m_state (0)
+    , m_pool (0)
+  {
+    copyFrom (other);
+  }
+
+  ~ChannelsState ()
+  {
+    destroy ();
+  }
+
+  ChannelsState& operator= (const ChannelsState& other)
+  {
+    if (this != &other)
+      copyFrom (other);
+    return *this;
+  }
+
+  int getNumChannels() const
+  {
+    return m_numChannels;
+  }
+
+  // Every channel starts out reset
+  void setNumChannels (int numChannels)
+  {
+    assert (numChannels >= 0);
+
+    if (numChannels != m_numChannels)
+    {
+      destroy ();
+
+      if (numChannels > 0)
+      {
+        m_state = static_cast<padded_t*> (
+          m_arena.allocate (numChannels * sizeof (padded_t)));
+        for (int i = 0; i < numChannels; ++i)
+          new (m_state + i) padded_t;
+        m_numChannels = numChannels;
+      }
+    }
+    else
+    {
+      reset ();
+    }
+  }
+
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_pool = pool;
+  }
+
+  WorkerPool* getWorkerPool () const
+  {
+    return m_pool;
+  }
+
+  void reset ()
+  {
+    for (int i = 0; i < m_numChannels; ++i)
+      m_state[i].reset();
+  }
+
+  StateType& operator[] (int index)
+  {
+    assert (index >= 0 && index < m_numChannels);
+    return m_state[index];
+  }
+
+  template <class Filter, typename Sample>
+  void process (int numSamples,
+                Sample* const* arrayOfChannels,
+                Filter& filter)
+  {
+    DenormalGuard guard;
+
+    processChannels (numSamples, m_numChannels, arrayOfChannels, m_state,
+                     filter, m_pool);
+  }
+
+  template <class Filter, typename Sample>
+  void processInterleaved (int numFrames,
+                           Sample* data,
+                           Filter& filter)
+  {
+    DenormalGuard guard;
+
+    Dsp::processInterleaved (numFrames, m_numChannels, data, m_state, filter);
+  }
+
+private:
+  void destroy ()
+  {
+    for (int i = 0; i < m_numChannels; ++i)
+      m_state[i].~padded_t();
+    m_arena.free ();
+    m_state = 0;
+    m_numChannels = 0;
+  }
+
+  void copyFrom (const ChannelsState& other)
+  {
+    setNumChannels (other.m_numChannels);
+    for (int i = 0; i < m_numChannels; ++i)
+      m_state[i] = other.m_state[i];
+  }
+
+private:
+  typedef PaddedState <StateType> padded_t;
+
+  int m_numChannels;
+  padded_t* m_state;
+  StateArena m_arena;
+  WorkerPool* m_pool;
 };
 
 // Empty state, can't process anything
@@ -292,7 +971,17 @@ template <class StateType>
 class ChannelsState <0, StateType>
 {
 public:
-  const int getNumChannels() const
+  int getNumChannels() const
+  {
+    return 0;
+  }
+
+  // No channels to spread, so the pool is ignored
+  void setWorkerPool (WorkerPool*)
+  {
+  }
+
+  WorkerPool* getWorkerPool () const
   {
     return 0;
   }
@@ -303,9 +992,17 @@ public:
   }
 
   template <class FilterDesign, typename Sample>
-  void process (int numSamples,
-                Sample* const* arrayOfChannels,
-                FilterDesign& filter)
+  void process (int,
+                Sample* const*,
+                FilterDesign&)
+  {
+    throw std::logic_error ("attempt to process empty ChannelState");
+  }
+
+  template <class FilterDesign, typename Sample>
+  void processInterleaved (int,
+                           Sample*,
+                           FilterDesign&)
   {
     throw std::logic_error ("attempt to process empty ChannelState");
   }
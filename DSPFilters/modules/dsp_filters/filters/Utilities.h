@@ -102,8 +102,6 @@ void copy (int samples,
   {
     if (destSkip != 0)
     {
-      ++srcSkip;
-      ++destSkip;
       while (--samples >= 0)
       {
         *dest++ = *src++;
@@ -113,7 +111,6 @@ void copy (int samples,
     }
     else
     {
-      ++srcSkip;
       while (--samples >= 0)
       {
         *dest++ = *src++;
@@ -226,6 +223,49 @@ void deinterleave (int samples,
 
 //--------------------------------------------------------------------------
 
+// A view of interleaved channels, frame after frame, which stands in
+// for an array of channel pointers when processing. Adding n selects
+// the view starting at channel n, so groups of channels can be handed
+// on in the same way.
+template <typename Sample>
+class InterleavedChannels
+{
+public:
+  InterleavedChannels (Sample* data, int numChannels)
+    : m_data (data)
+    , m_stride (numChannels)
+  {
+  }
+
+  // The first channel of frame [index]
+  Sample* frame (int index) const
+  {
+    return m_data + index * m_stride;
+  }
+
+  Sample& at (int channel, int index) const
+  {
+    return m_data [index * m_stride + channel];
+  }
+
+  InterleavedChannels operator+ (int channel) const
+  {
+    return InterleavedChannels (m_data + channel, m_stride);
+  }
+
+  // The view starting at frame [index]
+  InterleavedChannels from (int index) const
+  {
+    return InterleavedChannels (frame (index), m_stride);
+  }
+
+private:
+  Sample* m_data;
+  int m_stride;
+};
+
+//--------------------------------------------------------------------------
+
 // Fade dest
 template <typename Td,
           typename Ty>
@@ -0,0 +1,234 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_VOICEBANK_H
+#define DSPFILTERS_VOICEBANK_H
+
+namespace Dsp {
+
+/*
+ * Runs many voices through second order sections of their own, such
+ * as the filters of a polyphonic synthesizer, each voice in place on
+ * its own channel.
+ *
+ * The coefficients are read from BiquadArrays on every call, so they
+ * can come straight from a batch design such as RBJ::Batch::LowPass at
+ * each control tick. A group of voices is processed in the lanes of a
+ * vector, one voice in each lane.
+ *
+ */
+
+// Processes one group of voices, one voice in each lane of Vector
+template <bool Supported>
+struct VoiceGroup
+{
+  template <class Vector, class StateType, typename Sample>
+  static void process (int numSamples,
+                       Sample* const* channels,
+                       const BiquadCoefficients <typename StateType::coefficient_t>* sections,
+                       StateType* states,
+                       typename StateType::value_t vsa)
+  {
+    typedef typename StateType::template Lanes <Vector> lanes_t;
+
+    lanes_t lanes;
+    for (int l = 0; l < Vector::lanes; ++l)
+    {
+      lanes.setCoefficients (l, sections[l]);
+      lanes.load (l, states[l]);
+    }
+
+    Vector v (vsa);
+    for (int i = 0; i < numSamples; ++i)
+    {
+      Vector x;
+      x.load (channels, i);
+      x = lanes.process1 (x, v);
+      x.store (channels, i);
+      v = -v;
+    }
+
+    for (int l = 0; l < Vector::lanes; ++l)
+      lanes.store (l, states[l]);
+  }
+};
+
+// Realizations without Lanes have groups of a single voice
+template <>
+struct VoiceGroup <false>
+{
+  template <class Vector, class StateType, typename Sample>
+  static void process (int numSamples,
+                       Sample* const* channels,
+                       const BiquadCoefficients <typename StateType::coefficient_t>* sections,
+                       StateType* states,
+                       typename StateType::value_t vsa)
+  {
+    StateType state = *states;
+    Sample* dest = channels[0];
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+      dest[i] = state.process1 (dest[i], *sections, vsa);
+      vsa = -vsa;
+    }
+
+    *states = state;
+  }
+};
+
+//------------------------------------------------------------------------------
+
+template <class StateType = DirectFormII>
+class VoiceBank : private DenormalPrevention
+{
+public:
+  typedef typename StateType::value_t value_t;
+  typedef typename StateType::coefficient_t coefficient_t;
+  typedef BiquadCoefficients <coefficient_t> stage_t;
+
+  enum
+  {
+    supportsLanes = LaneTraits <StateType>::supported,
+
+    // Number of voices processed together
+    groupSize = supportsLanes ? LaneWidth <value_t>::max : 1
+  };
+
+  VoiceBank ()
+    : m_numVoices (0)
+  {
+  }
+
+  int getNumVoices () const
+  {
+    return m_numVoices;
+  }
+
+  // The voices start out reset when their number changes
+  void setNumVoices (int numVoices)
+  {
+    assert (numVoices >= 0);
+
+    if (numVoices != m_numVoices)
+    {
+      const int numGroups = (numVoices + groupSize - 1) / groupSize;
+      m_states.assign (size_t (numGroups) * groupSize, StateType ());
+      m_numVoices = numVoices;
+    }
+  }
+
+  void reset ()
+  {
+    for (size_t i = 0; i < m_states.size (); ++i)
+      m_states[i].reset ();
+  }
+
+  // Filters channel i in place through section i of the arrays,
+  // for each of the voices.
+  template <typename Sample>
+  void process (int numSamples,
+                Sample* const* channels,
+                const BiquadArrays <double>& sections)
+  {
+    typedef LaneVector <groupSize, value_t> vector_t;
+
+    DenormalGuard guard;
+
+    if (numSamples <= 0 || m_numVoices == 0)
+      return;
+
+    const value_t vsa = value_t (ac());
+    if (!(numSamples & 1))
+      ac();
+
+    // lanes past the last voice filter silence through an identity
+    Sample unused [laneBlockSize];
+    stage_t stages [groupSize];
+    Sample* dest [groupSize];
+
+    for (int first = 0; first < m_numVoices; first += groupSize)
+    {
+      for (int l = 0; l < groupSize; ++l)
+      {
+        if (first + l < m_numVoices)
+          stages[l] = sections.template get <coefficient_t> (first + l);
+        else
+          stages[l] = identity ();
+      }
+
+      for (int offset = 0; offset < numSamples; offset += laneBlockSize)
+      {
+        const int n = std::min (numSamples - offset, int (laneBlockSize));
+
+        for (int l = 0; l < groupSize; ++l)
+        {
+          if (first + l < m_numVoices)
+            dest[l] = channels[first + l] + offset;
+          else
+          {
+            std::fill (unused, unused + n, Sample (0));
+            dest[l] = unused;
+          }
+        }
+
+        // blocks have an even length, so each starts with the same sign
+        VoiceGroup <supportsLanes>::template process <vector_t> (
+          n, dest, stages, &m_states[first], vsa);
+      }
+    }
+  }
+
+private:
+  static stage_t identity ()
+  {
+    stage_t s;
+    s.m_a0 = 1;
+    s.m_a1 = 0;
+    s.m_a2 = 0;
+    s.m_b0 = 1;
+    s.m_b1 = 0;
+    s.m_b2 = 0;
+    return s;
+  }
+
+private:
+  int m_numVoices;
+  std::vector<StateType> m_states;
+};
+
+}
+
+#endif
@@ -0,0 +1,267 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#endif
+
+namespace Dsp {
+
+//------------------------------------------------------------------------------
+
+// Everything the threads share is guarded by the lock. Parts are
+// handed out one at a time, whichever thread asks first gets the
+// next one.
+struct WorkerPool::Shared
+{
+#ifdef _WIN32
+  typedef HANDLE thread_t;
+
+  struct Lock
+  {
+    Lock () { InitializeSRWLock (&lock); InitializeConditionVariable (&changed); }
+    void enter () { AcquireSRWLockExclusive (&lock); }
+    void exit () { ReleaseSRWLockExclusive (&lock); }
+    void wait () { SleepConditionVariableSRW (&changed, &lock, INFINITE, 0); }
+    void notify () { WakeAllConditionVariable (&changed); }
+
+    SRWLOCK lock;
+    CONDITION_VARIABLE changed;
+  };
+#else
+  typedef pthread_t thread_t;
+
+  struct Lock
+  {
+    Lock () { pthread_mutex_init (&lock, 0); pthread_cond_init (&changed, 0); }
+    ~Lock () { pthread_cond_destroy (&changed); pthread_mutex_destroy (&lock); }
+    void enter () { pthread_mutex_lock (&lock); }
+    void exit () { pthread_mutex_unlock (&lock); }
+    void wait () { pthread_cond_wait (&changed, &lock); }
+    void notify () { pthread_cond_broadcast (&changed); }
+
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+  };
+#endif
+
+  Shared ()
+    : task (0)
+    , numParts (0)
+    , nextPart (0)
+    , remainingParts (0)
+    , generation (0)
+    , quit (false)
+  {
+  }
+
+  // Runs parts of the current task until there are none left.
+  // Call with the lock held.
+  void runParts ()
+  {
+    while (nextPart < numParts)
+    {
+      const int part = nextPart++;
+      lock.exit ();
+      task->run (part);
+      lock.enter ();
+
+      if (--remainingParts == 0)
+        lock.notify ();
+    }
+  }
+
+  // Tells the threads to finish and waits for them
+  void stop ()
+  {
+    lock.enter ();
+    quit = true;
+    lock.notify ();
+    lock.exit ();
+
+    for (size_t i = 0; i < threads.size (); ++i)
+    {
+#ifdef _WIN32
+      WaitForSingleObject (threads[i], INFINITE);
+      CloseHandle (threads[i]);
+#else
+      pthread_join (threads[i], 0);
+#endif
+    }
+
+    threads.clear ();
+  }
+
+  void work ()
+  {
+    lock.enter ();
+
+    unsigned long seen = generation;
+    for (;;)
+    {
+      while (generation == seen && !quit)
+        lock.wait ();
+
+      if (quit)
+        break;
+
+      seen = generation;
+      runParts ();
+    }
+
+    lock.exit ();
+  }
+
+#ifdef _WIN32
+  static DWORD WINAPI threadProc (LPVOID shared)
+  {
+    static_cast<Shared*> (shared)->work ();
+    return 0;
+  }
+#else
+  static void* threadProc (void* shared)
+  {
+    static_cast<Shared*> (shared)->work ();
+    return 0;
+  }
+#endif
+
+  Lock lock;
+  std::vector<thread_t> threads;
+  Task* task;
+  int numParts;
+  int nextPart;
+  int remainingParts;
+  unsigned long generation;
+  bool quit;
+};
+
+//------------------------------------------------------------------------------
+
+WorkerPool::WorkerPool (int numWorkers)
+  : m_shared (new Shared)
+{
+  assert (numWorkers >= 0);
+
+  for (int i = 0; i < numWorkers; ++i)
+  {
+#ifdef _WIN32
+    Shared::thread_t thread = CreateThread (0, 0, Shared::threadProc, m_shared, 0, 0);
+    const bool created = thread != 0;
+#else
+    Shared::thread_t thread;
+    const bool created =
+      pthread_create (&thread, 0, Shared::threadProc, m_shared) == 0;
+#endif
+
+    if (!created)
+    {
+      m_shared->stop ();
+      delete m_shared;
+      throw std::runtime_error ("can't create worker thread");
+    }
+
+    m_shared->threads.push_back (thread);
+  }
+}
+
+WorkerPool::~WorkerPool ()
+{
+  m_shared->stop ();
+  delete m_shared;
+}
+
+int WorkerPool::getNumWorkers () const
+{
+  return int (m_shared->threads.size ());
+}
+
+bool WorkerPool::pinWorker (int worker, int core)
+{
+  assert (worker >= 0 && worker < getNumWorkers ());
+
+#if defined(_WIN32)
+  if (core < 0 || core >= int (sizeof (DWORD_PTR) * 8))
+    return false;
+  return SetThreadAffinityMask (m_shared->threads[worker],
+                                DWORD_PTR (1) << core) != 0;
+#elif defined(__linux__)
+  if (core < 0 || core >= CPU_SETSIZE)
+    return false;
+  cpu_set_t cores;
+  CPU_ZERO (&cores);
+  CPU_SET (core, &cores);
+  return pthread_setaffinity_np (m_shared->threads[worker],
+                                 sizeof (cores), &cores) == 0;
+#else
+  return false;
+#endif
+}
+
+void WorkerPool::run (Task& task, int numParts)
+{
+  Shared& s = *m_shared;
+
+  s.lock.enter ();
+
+  s.task = &task;
+  s.numParts = numParts;
+  s.nextPart = 0;
+  s.remainingParts = numParts;
+  ++s.generation;
+  s.lock.notify ();
+
+  // the calling thread helps, then waits for the parts still running
+  s.runParts ();
+  while (s.remainingParts > 0)
+    s.lock.wait ();
+
+  s.task = 0;
+
+  s.lock.exit ();
+}
+
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_WORKERPOOL_H
+#define DSPFILTERS_WORKERPOOL_H
+
+namespace Dsp {
+
+/*
+ * Persistent threads which take part in processing a block
+ *
+ * run() hands out the parts of a task to the workers and to the
+ * calling thread, and returns once every part is done. The workers
+ * stay alive between blocks and wait for the next task, so the only
+ * cost per block is waking them up and waiting for the last part.
+ *
+ * A pool runs one task at a time. Filters which share a pool must
+ * be processed from the same thread, or one after the other.
+ *
+ */
+
+class WorkerPool
+{
+public:
+  class Task
+  {
+  public:
+    virtual ~Task () { }
+
+    // Called once for each part, from any of the threads
+    virtual void run (int part) = 0;
+  };
+
+  // The calling thread of run() is not counted in numWorkers
+  explicit WorkerPool (int numWorkers);
+  ~WorkerPool ();
+
+  int getNumWorkers () const;
+
+  // Restricts a worker to one core. Returns false where the
+  // system does not support it.
+  bool pinWorker (int worker, int core);
+
+  void run (Task& task, int numParts);
+
+private:
+  WorkerPool (const WorkerPool&);
+  WorkerPool& operator= (const WorkerPool&);
+
+  struct Shared;
+
+private:
+  Shared* m_shared;
+};
+
+}
+
+#endif
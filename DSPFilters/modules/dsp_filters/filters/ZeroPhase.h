@@ -0,0 +1,346 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPFILTERS_ZEROPHASE_H
+#define DSPFILTERS_ZEROPHASE_H
+
+namespace Dsp {
+
+/*
+ * Zero phase filtering of whole signals
+ *
+ * The signal runs through the filter forwards and then backwards, so
+ * the phase shifts of the two passes cancel and the magnitude response
+ * is squared, as with filtfilt() in other packages. Each end of the
+ * signal is extended by its odd reflection, and each pass starts in the
+ * state that a constant input equal to its first sample would have
+ * settled the filter in, so neither edge rings. The reflections are as
+ * long as the overlap below, or the signal if that is shorter.
+ *
+ * Long signals are cut into chunks which are filtered independently.
+ * A chunk is extended on both sides by an overlap, long enough for the
+ * start up transient of the slowest pole to decay by a factor of 10^10
+ * before the samples that are kept. The chunks of every channel are
+ * shared out among the threads of a WorkerPool if there is one, and
+ * the working memory of each thread depends only on the chunk size, so
+ * the source and destination may be memory mapped files of any length.
+ *
+ */
+
+template <class StateType = DirectFormII>
+class ZeroPhase
+{
+public:
+  typedef typename StateType::value_t value_t;
+  typedef typename StateType::coefficient_t coefficient_t;
+
+  enum
+  {
+    // Smallest chunk when the size is chosen automatically
+    defaultChunkSize = 65536
+  };
+
+  explicit ZeroPhase (const Cascade& cascade)
+    : m_pool (0)
+    , m_chunkSize (0)
+  {
+    for (int i = 0; i < cascade.getNumStages (); ++i)
+      m_stages.push_back (stage_t (cascade[i]));
+    m_overlap = findOverlap ();
+  }
+
+  explicit ZeroPhase (const BiquadBase& biquad)
+    : m_pool (0)
+    , m_chunkSize (0)
+  {
+    m_stages.push_back (stage_t (biquad));
+    m_overlap = findOverlap ();
+  }
+
+  void setWorkerPool (WorkerPool* pool)
+  {
+    m_pool = pool;
+  }
+
+  // Zero picks a size large enough to keep the overlap small
+  void setChunkSize (size_t chunkSize)
+  {
+    m_chunkSize = chunkSize;
+  }
+
+  // Samples added to each side of a chunk, chosen from the
+  // poles when the filter is given
+  void setOverlap (size_t overlap)
+  {
+    m_overlap = overlap;
+  }
+
+  size_t getOverlap () const
+  {
+    return m_overlap;
+  }
+
+  // src and dest hold numSamples for each channel, and may not overlap
+  template <typename Sample>
+  void process (int numChannels,
+                size_t numSamples,
+                const Sample* const* src,
+                Sample* const* dest)
+  {
+    std::vector<Channel <Sample> > channels (numChannels);
+    for (int i = 0; i < numChannels; ++i)
+      channels[i] = Channel <Sample> (src[i], dest[i], 1);
+    run (channels, numSamples);
+  }
+
+  // The same for frames of interleaved channels
+  template <typename Sample>
+  void processInterleaved (int numChannels,
+                           size_t numFrames,
+                           const Sample* src,
+                           Sample* dest)
+  {
+    std::vector<Channel <Sample> > channels (numChannels);
+    for (int i = 0; i < numChannels; ++i)
+      channels[i] = Channel <Sample> (src + i, dest + i, numChannels);
+    run (channels, numFrames);
+  }
+
+private:
+  typedef BiquadCoefficients <coefficient_t> stage_t;
+
+  template <typename Sample>
+  struct Channel
+  {
+    Channel ()
+    {
+    }
+
+    Channel (const Sample* src_, Sample* dest_, int stride_)
+      : src (src_)
+      , dest (dest_)
+      , stride (stride_)
+    {
+    }
+
+    const Sample* src;
+    Sample* dest;
+    int stride;
+  };
+
+  // Work shared by the threads, made of the chunks of every channel
+  template <typename Sample>
+  class Task : public WorkerPool::Task
+  {
+  public:
+    Task (const ZeroPhase& filter,
+          const std::vector<Channel <Sample> >& channels,
+          size_t numSamples,
+          size_t chunkSize,
+          int numParts)
+      : m_filter (filter)
+      , m_channels (channels)
+      , m_numSamples (numSamples)
+      , m_chunkSize (chunkSize)
+      , m_numChunks ((numSamples + chunkSize - 1) / chunkSize)
+      , m_numParts (numParts)
+    {
+    }
+
+    size_t getNumItems () const
+    {
+      return m_channels.size () * m_numChunks;
+    }
+
+    void run (int part)
+    {
+      // decaying tails are flushed rather than offset, an offset
+      // would be amplified by the gain of the later stages
+      ScopedFlushDenormals flush;
+
+      std::vector<value_t> buf;
+      std::vector<StateType> states (m_filter.m_stages.size ());
+
+      const size_t first = getNumItems () * part / m_numParts;
+      const size_t last = getNumItems () * (part + 1) / m_numParts;
+
+      for (size_t item = first; item < last; ++item)
+      {
+        const size_t chunk = item % m_numChunks;
+        const size_t offset = chunk * m_chunkSize;
+        m_filter.processChunk (m_channels [item / m_numChunks],
+                               m_numSamples,
+                               offset,
+                               std::min (m_chunkSize, m_numSamples - offset),
+                               buf,
+                               &states[0]);
+      }
+    }
+
+  private:
+    const ZeroPhase& m_filter;
+    const std::vector<Channel <Sample> >& m_channels;
+    size_t m_numSamples;
+    size_t m_chunkSize;
+    size_t m_numChunks;
+    int m_numParts;
+  };
+
+  template <typename Sample>
+  void run (const std::vector<Channel <Sample> >& channels, size_t numSamples)
+  {
+    if (numSamples == 0 || channels.empty () || m_stages.empty ())
+      return;
+
+    // the overlap costs twice its length for every chunk
+    size_t chunkSize = m_chunkSize;
+    if (chunkSize == 0)
+      chunkSize = m_overlap < numSamples / 8 ?
+        std::max (size_t (defaultChunkSize), 8 * m_overlap) : numSamples;
+
+    Task <Sample> task (*this, channels, numSamples, chunkSize, 1);
+    const size_t numItems = task.getNumItems ();
+    const int numParts = m_pool ?
+      int (std::min (size_t (m_pool->getNumWorkers () + 1), numItems)) : 1;
+
+    if (numParts > 1)
+    {
+      Task <Sample> parts (*this, channels, numSamples, chunkSize, numParts);
+      m_pool->run (parts, numParts);
+    }
+    else
+    {
+      task.run (0);
+    }
+  }
+
+  // Filters count samples starting at offset, with as much of the
+  // signal around them as the overlap asks for.
+  template <typename Sample>
+  void processChunk (const Channel <Sample>& c,
+                     size_t numSamples,
+                     size_t offset,
+                     size_t count,
+                     std::vector<value_t>& buf,
+                     StateType* states) const
+  {
+    // positions in the extended signal, which starts with the padding
+    const size_t padding = getPadding (numSamples);
+    const size_t length = numSamples + 2 * padding;
+    const size_t begin = padding + offset;
+    const size_t end = begin + count;
+    const size_t first = begin > m_overlap ? begin - m_overlap : 0;
+    const size_t last = length - end > m_overlap ? end + m_overlap : length;
+
+    buf.resize (last - first);
+    for (size_t i = first; i < last; ++i)
+      buf[i - first] = extended (c, numSamples, padding, i);
+
+    value_t* const data = &buf[0];
+    filter (last - first, data, states);
+    std::reverse (data + begin - first, data + last - first);
+    filter (last - begin, data + begin - first, states);
+    std::reverse (data + begin - first, data + last - first);
+
+    for (size_t i = 0; i < count; ++i)
+      c.dest[(offset + i) * c.stride] = static_cast<Sample> (
+        data[begin - first + i]);
+  }
+
+  // The extension at each end is as long as the overlap, so that
+  // the transient of a signal which is not constant near its ends
+  // has died away before the first sample.
+  size_t getPadding (size_t numSamples) const
+  {
+    return std::min (std::max (m_overlap, 3 * (2 * m_stages.size () + 1)),
+                     numSamples - 1);
+  }
+
+  // Sample i of the signal extended by an odd reflection at each end
+  template <typename Sample>
+  static value_t extended (const Channel <Sample>& c,
+                           size_t numSamples,
+                           size_t padding,
+                           size_t i)
+  {
+    if (i < padding)
+    {
+      return 2 * static_cast<value_t> (c.src[0]) -
+                 static_cast<value_t> (c.src[(padding - i) * c.stride]);
+    }
+    else if (i - padding < numSamples)
+    {
+      return static_cast<value_t> (c.src[(i - padding) * c.stride]);
+    }
+    else
+    {
+      const size_t last = numSamples - 1;
+      return 2 * static_cast<value_t> (c.src[last * c.stride]) -
+                 static_cast<value_t> (c.src[(2 * last + padding - i) * c.stride]);
+    }
+  }
+
+  // One pass over the samples in place, one stage at a time, starting
+  // from the steady state for the first sample.
+  void filter (size_t n, value_t* data, StateType* states) const
+  {
+    const int numStages = int (m_stages.size ());
+
+    value_t in = data[0];
+    for (int j = 0; j < numStages; ++j)
+      in = states[j].setSteadyState (in, m_stages[j]);
+
+    processSections (n, data, numStages, &m_stages[0], states);
+  }
+
+  // Samples after which the slowest pole has decayed by 10^10
+  size_t findOverlap () const
+  {
+    if (m_stages.empty ())
+      return 0;
+
+    return decayLength (int (m_stages.size ()), &m_stages[0], 1e-10);
+  }
+
+private:
+  std::vector<stage_t> m_stages;
+  WorkerPool* m_pool;
+  size_t m_chunkSize;
+  size_t m_overlap;
+};
+
+}
+
+#endif
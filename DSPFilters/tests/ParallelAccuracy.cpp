@@ -0,0 +1,161 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+/*
+ * Checks Cascade::parallel against the cascade it was expanded from.
+ *
+ * Every even order up to 50 is run, with double and float state, for
+ * designs whose poles crowd together at low and high cutoffs. The
+ * parallel form may fall back to the cascade when its expansion is
+ * poorly conditioned; either way the output must stay within the
+ * bound for the precision, relative to the output level. The highest
+ * order that really ran in parallel form is printed as well.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+enum
+{
+  maxOrder = 50,
+  numSamples = 8192
+};
+
+const double maxDoubleError = 1e-7;
+const double maxFloatError = 1e-4;
+
+// Relative difference between the sample-major and parallel output,
+// with samples in the precision of the state
+template <typename Sample, class FilterClass>
+double measureError (FilterClass& f, const std::vector<double>& input)
+{
+  std::vector<Sample> expected (input.begin (), input.end ());
+  std::vector<Sample> actual (expected);
+  Sample* data;
+
+  f.setProcessing (Dsp::Cascade::sampleMajor);
+  f.reset ();
+  data = &expected[0];
+  f.process (numSamples, &data);
+
+  f.setProcessing (Dsp::Cascade::parallel);
+  f.reset ();
+  data = &actual[0];
+  f.process (numSamples, &data);
+
+  double error = 0;
+  double level = 0;
+  for (int i = 0; i < numSamples; ++i)
+  {
+    error += (double (actual[i]) - expected[i]) * (double (actual[i]) - expected[i]);
+    level += double (expected[i]) * expected[i];
+  }
+
+  return std::sqrt (error / level);
+}
+
+template <class DesignClass, class StateType>
+bool check (const char* name, double cutoffFrequency, double maxError,
+            const std::vector<double>& input)
+{
+  Dsp::SimpleFilter <DesignClass, 1, StateType> f;
+
+  double worst = 0;
+  int parallelOrder = 0;
+  for (int order = 2; order <= maxOrder; order += 2)
+  {
+    f.setup (order, 44100, cutoffFrequency);
+    worst = std::max (worst,
+      measureError <typename StateType::value_t> (f, input));
+    if (f.usesParallel (typename StateType::coefficient_t ()))
+      parallelOrder = order;
+  }
+
+  const bool passed = worst <= maxError;
+  std::printf ("%-36s %10.3g %9d  %s\n", name, worst, parallelOrder,
+               passed ? "ok" : "FAILED");
+
+  return passed;
+}
+
+template <class DesignClass>
+bool check (const char* name, double cutoffFrequency,
+            const std::vector<double>& input)
+{
+  char label [64];
+  bool passed = true;
+
+  std::sprintf (label, "%s, double", name);
+  passed &= check <DesignClass, Dsp::DirectFormII> (
+    label, cutoffFrequency, maxDoubleError, input);
+
+  std::sprintf (label, "%s, float", name);
+  passed &= check <DesignClass, Dsp::BasicDirectFormII <float> > (
+    label, cutoffFrequency, maxFloatError, input);
+
+  return passed;
+}
+
+}
+
+int main ()
+{
+  using namespace Dsp;
+
+  std::vector<double> input (numSamples);
+  for (int i = 0; i < numSamples; ++i)
+    input[i] = std::rand () / double (RAND_MAX) - 0.5;
+
+  std::printf ("%-36s %10s %9s\n", "design", "error", "parallel");
+
+  bool passed = true;
+  passed &= check <Butterworth::LowPass <maxOrder> > (
+    "Butterworth low pass, 20 Hz", 20, input);
+  passed &= check <Butterworth::LowPass <maxOrder> > (
+    "Butterworth low pass, 1 kHz", 1000, input);
+  passed &= check <Butterworth::LowPass <maxOrder> > (
+    "Butterworth low pass, 20 kHz", 20000, input);
+  passed &= check <Butterworth::HighPass <maxOrder> > (
+    "Butterworth high pass, 100 Hz", 100, input);
+
+  return passed ? 0 : 1;
+}
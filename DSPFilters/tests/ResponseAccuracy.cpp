@@ -0,0 +1,182 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+/*
+ * Checks the batched FrequencyResponse measures against the response()
+ * of the filter at each frequency, for designs with poles and zeros
+ * close to DC or Nyquist, where the squared magnitudes are easily
+ * formed by cancellation.
+ *
+ * Frequencies are spaced logarithmically from 1e-3 Hz to Nyquist, and
+ * also evenly to exercise the rotated points. Magnitudes are compared
+ * in decibels down to -100 dB. Below that, next to the zeros of a
+ * stopband, neither calculation has many digits left, so only the
+ * difference in magnitude is bounded.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+enum
+{
+  numFrequencies = 4000
+};
+
+const double maxErrorDb = 1e-6;
+const double maxError = 1e-9;
+const double floorDb = -100;
+
+struct Errors
+{
+  Errors ()
+    : db (0)
+    , magnitude (0)
+  {
+  }
+
+  bool passed () const
+  {
+    return db <= maxErrorDb && magnitude <= maxError;
+  }
+
+  double db;
+  double magnitude;
+};
+
+// Largest differences from response(), in decibels and in magnitude
+void measureErrors (const Dsp::Filter& f,
+                    const std::vector<double>& frequencies,
+                    const std::vector<double>& gainDb,
+                    const std::vector<double>& magnitude,
+                    Errors& errors)
+{
+  for (size_t i = 0; i < frequencies.size (); ++i)
+  {
+    const double expected = std::abs (f.response (frequencies[i]));
+    const double expectedDb = 20 * log10 (expected);
+
+    errors.magnitude = std::max (errors.magnitude, std::abs (magnitude[i] - expected));
+    errors.magnitude = std::max (errors.magnitude, std::abs (pow (10, gainDb[i] / 20) - expected));
+
+    if (expectedDb >= floorDb)
+    {
+      errors.db = std::max (errors.db, std::abs (gainDb[i] - expectedDb));
+      errors.db = std::max (errors.db, std::abs (20 * log10 (magnitude[i]) - expectedDb));
+    }
+  }
+}
+
+bool check (const char* name, Dsp::Filter& f, const Dsp::Params& params)
+{
+  f.setParams (params);
+  const double sampleRate = params[0];
+
+  std::vector<double> logFrequencies (numFrequencies);
+  std::vector<double> evenFrequencies (numFrequencies);
+  for (int i = 0; i < numFrequencies; ++i)
+  {
+    const double hz = 1e-3 * pow (sampleRate / 2 / 1e-3, double (i) / (numFrequencies - 1));
+    logFrequencies[i] = std::min (hz / sampleRate, 0.5);
+    evenFrequencies[i] = 0.5 * i / (numFrequencies - 1);
+  }
+
+  std::vector<double> gainDb (numFrequencies);
+  std::vector<double> magnitude (numFrequencies);
+
+  Errors errors;
+
+  f.response (Dsp::FrequencyResponse::gainDb, numFrequencies, &logFrequencies[0], &gainDb[0]);
+  f.response (Dsp::FrequencyResponse::magnitude, numFrequencies, &logFrequencies[0], &magnitude[0]);
+  measureErrors (f, logFrequencies, gainDb, magnitude, errors);
+
+  const double spacing = evenFrequencies[1];
+  f.response (Dsp::FrequencyResponse::gainDb, numFrequencies, 0., spacing, &gainDb[0]);
+  f.response (Dsp::FrequencyResponse::magnitude, numFrequencies, 0., spacing, &magnitude[0]);
+  measureErrors (f, evenFrequencies, gainDb, magnitude, errors);
+
+  const bool passed = errors.passed ();
+  std::printf ("%-40s %10.3g dB %12.3g  %s\n", name, errors.db, errors.magnitude,
+               passed ? "ok" : "FAILED");
+
+  return passed;
+}
+
+template <class DesignClass>
+bool check (const char* name, double p0, double p1, double p2, double p3, double p4 = 0)
+{
+  Dsp::FilterDesign <DesignClass, 1> design;
+  Dsp::Filter& f = design;
+  Dsp::Params params = f.getDefaultParams ();
+  params[0] = p0;
+  params[1] = p1;
+  params[2] = p2;
+  params[3] = p3;
+  params[4] = p4;
+  return check (name, f, params);
+}
+
+}
+
+int main ()
+{
+  using namespace Dsp;
+
+  std::printf ("%-40s %13s %12s\n", "design", "above -100 dB", "magnitude");
+
+  bool passed = true;
+  passed &= check <ChebyshevII::Design::HighPass <12> > (
+    "ChebyshevII high pass 12, 30 Hz, 60 dB", 48000, 12, 30, 60);
+  passed &= check <ChebyshevII::Design::LowPass <12> > (
+    "ChebyshevII low pass 12, 23.9 kHz, 60 dB", 48000, 12, 23900, 60);
+  passed &= check <Butterworth::Design::HighPass <16> > (
+    "Butterworth high pass 16, 20 Hz", 48000, 16, 20, 0);
+  passed &= check <Butterworth::Design::LowPass <16> > (
+    "Butterworth low pass 16, 20 Hz", 48000, 16, 20, 0);
+  passed &= check <ChebyshevI::Design::LowPass <8> > (
+    "ChebyshevI low pass 8, 23 kHz, 1 dB", 48000, 8, 23000, 1);
+  passed &= check <Elliptic::Design::LowPass <16> > (
+    "Elliptic low pass 16, 2 kHz", 44100, 16, 2000, 1, 0.2);
+  passed &= check <Butterworth::Design::BandStop <8> > (
+    "Butterworth band stop 8, 23.5 kHz", 48000, 8, 23500, 200);
+
+  return passed ? 0 : 1;
+}
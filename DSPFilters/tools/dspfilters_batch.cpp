@@ -0,0 +1,917 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+/*
+ * Applies a filter to a set of WAV or raw files from the command line.
+ *
+ * Usage: dspfilters_batch --filter Family/Kind [options] file...
+ *
+ *   --filter    Family/Kind, for example Butterworth/LowPass or
+ *               RBJ/BandPass2
+ *   --param     Label=value, repeatable. The labels are those of the
+ *               filter parameters: Order, Fc, Q, BW, Gain, Slope,
+ *               Ripple, Stop and W. The sample rate defaults to that
+ *               of each file.
+ *   --state     DirectFormI, DirectFormII (the default),
+ *               TransposedDirectFormI, TransposedDirectFormII, and
+ *               each with a "<float>" suffix
+ *   --output    directory for the filtered files, which keep their
+ *               names. It may not hold the input files themselves.
+ *   --in-place  filter the files themselves instead
+ *   --jobs      number of files filtered at once, the number of
+ *               cores by default
+ *   --raw       format of files without a WAV header: s16, s24, s32,
+ *               f32 or f64, little endian and interleaved
+ *   --channels  channels of raw files, 1 by default
+ *   --rate      sample rate of raw files, 44100 by default
+ *   --list      print the parameters of the filter and exit
+ *
+ * WAV files may hold 8, 16, 24 or 32 bit integer samples or 32 or 64
+ * bit floating point samples. Output files have the format of their
+ * input, and integer samples are rounded and clipped.
+ *
+ * Files are read and written through memory maps, so the data is
+ * never copied into a buffer of the whole file. Each worker thread
+ * takes the next file from the list and filters it a block at a time,
+ * with all of its channels interleaved as they are stored.
+ *
+ */
+
+#include "dsp_filters/dsp_filters.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+enum
+{
+  maxOrder = 50,
+  blockFrames = 4096
+};
+
+//------------------------------------------------------------------------------
+
+const char* const stateNames [] =
+{
+  "DirectFormI",
+  "DirectFormII",
+  "TransposedDirectFormI",
+  "TransposedDirectFormII",
+  "DirectFormI<float>",
+  "DirectFormII<float>",
+  "TransposedDirectFormI<float>",
+  "TransposedDirectFormII<float>"
+};
+
+const int numStates = sizeof (stateNames) / sizeof (stateNames[0]);
+
+template <class DesignClass, class StateType>
+Dsp::Filter* createWithState (int numChannels)
+{
+  Dsp::FilterDesign <DesignClass, Dsp::dynamicChannels, StateType>* f =
+    new Dsp::FilterDesign <DesignClass, Dsp::dynamicChannels, StateType>;
+  f->setNumChannels (numChannels);
+  return f;
+}
+
+template <class DesignClass>
+Dsp::Filter* create (int state, int numChannels)
+{
+  switch (state)
+  {
+  case 0: return createWithState <DesignClass, Dsp::DirectFormI> (numChannels);
+  case 1: return createWithState <DesignClass, Dsp::DirectFormII> (numChannels);
+  case 2: return createWithState <DesignClass, Dsp::TransposedDirectFormI> (numChannels);
+  case 3: return createWithState <DesignClass, Dsp::TransposedDirectFormII> (numChannels);
+  case 4: return createWithState <DesignClass, Dsp::BasicDirectFormI <float> > (numChannels);
+  case 5: return createWithState <DesignClass, Dsp::BasicDirectFormII <float> > (numChannels);
+  case 6: return createWithState <DesignClass, Dsp::BasicTransposedDirectFormI <float> > (numChannels);
+  case 7: return createWithState <DesignClass, Dsp::BasicTransposedDirectFormII <float> > (numChannels);
+  };
+
+  return 0;
+}
+
+struct Design
+{
+  const char* name;
+  Dsp::Filter* (*create) (int state, int numChannels);
+};
+
+#define DESIGN(family, kind) \
+  { #family "/" #kind, create <Dsp::family::Design::kind <maxOrder> > }
+
+#define RBJ_DESIGN(kind) \
+  { "RBJ/" #kind, create <Dsp::RBJ::Design::kind> }
+
+const Design designs [] =
+{
+  DESIGN (Butterworth, LowPass),
+  DESIGN (Butterworth, HighPass),
+  DESIGN (Butterworth, BandPass),
+  DESIGN (Butterworth, BandStop),
+  DESIGN (Butterworth, LowShelf),
+  DESIGN (Butterworth, HighShelf),
+  DESIGN (Butterworth, BandShelf),
+
+  DESIGN (ChebyshevI, LowPass),
+  DESIGN (ChebyshevI, HighPass),
+  DESIGN (ChebyshevI, BandPass),
+  DESIGN (ChebyshevI, BandStop),
+  DESIGN (ChebyshevI, LowShelf),
+  DESIGN (ChebyshevI, HighShelf),
+  DESIGN (ChebyshevI, BandShelf),
+
+  DESIGN (ChebyshevII, LowPass),
+  DESIGN (ChebyshevII, HighPass),
+  DESIGN (ChebyshevII, BandPass),
+  DESIGN (ChebyshevII, BandStop),
+  DESIGN (ChebyshevII, LowShelf),
+  DESIGN (ChebyshevII, HighShelf),
+  DESIGN (ChebyshevII, BandShelf),
+
+  DESIGN (Elliptic, LowPass),
+  DESIGN (Elliptic, HighPass),
+  DESIGN (Elliptic, BandPass),
+  DESIGN (Elliptic, BandStop),
+
+  DESIGN (Bessel, LowPass),
+  DESIGN (Bessel, HighPass),
+  DESIGN (Bessel, BandPass),
+  DESIGN (Bessel, BandStop),
+  DESIGN (Bessel, LowShelf),
+
+  DESIGN (Legendre, LowPass),
+  DESIGN (Legendre, HighPass),
+  DESIGN (Legendre, BandPass),
+  DESIGN (Legendre, BandStop),
+
+  RBJ_DESIGN (LowPass),
+  RBJ_DESIGN (HighPass),
+  RBJ_DESIGN (BandPass1),
+  RBJ_DESIGN (BandPass2),
+  RBJ_DESIGN (BandStop),
+  RBJ_DESIGN (LowShelf),
+  RBJ_DESIGN (HighShelf),
+  RBJ_DESIGN (BandShelf),
+  RBJ_DESIGN (AllPass)
+};
+
+#undef DESIGN
+#undef RBJ_DESIGN
+
+const int numDesigns = sizeof (designs) / sizeof (designs[0]);
+
+//------------------------------------------------------------------------------
+
+// Encodings of the samples in a file
+enum Encoding
+{
+  encodingU8,
+  encodingS16,
+  encodingS24,
+  encodingS32,
+  encodingF32,
+  encodingF64
+};
+
+int bytesPerSample (Encoding encoding)
+{
+  switch (encoding)
+  {
+  case encodingU8: return 1;
+  case encodingS16: return 2;
+  case encodingS24: return 3;
+  case encodingS32: return 4;
+  case encodingF32: return 4;
+  case encodingF64: return 8;
+  };
+
+  return 0;
+}
+
+// Where the samples are in a file, and how they are stored
+struct Layout
+{
+  Encoding encoding;
+  int numChannels;
+  double sampleRate;
+  size_t dataOffset;
+  size_t numFrames;
+};
+
+double clip (double v, double lo, double hi)
+{
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+long roundToLong (double v)
+{
+  return long (v < 0 ? v - 0.5 : v + 0.5);
+}
+
+// Converts little endian samples to double, scaled to [-1, 1)
+void decode (Encoding encoding, const unsigned char* src, double* dest, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    switch (encoding)
+    {
+    case encodingU8:
+      dest[i] = (int (src[i]) - 128) * (1. / 128);
+      break;
+
+    case encodingS16:
+      dest[i] = short (src[2*i] | (src[2*i+1] << 8)) * (1. / 32768);
+      break;
+
+    case encodingS24:
+      {
+        const int v = (src[3*i] << 8) | (src[3*i+1] << 16) | (src[3*i+2] << 24);
+        dest[i] = (v >> 8) * (1. / 8388608);
+      }
+      break;
+
+    case encodingS32:
+      {
+        int v;
+        std::memcpy (&v, src + 4*i, 4);
+        dest[i] = v * (1. / 2147483648.);
+      }
+      break;
+
+    case encodingF32:
+      {
+        float v;
+        std::memcpy (&v, src + 4*i, 4);
+        dest[i] = v;
+      }
+      break;
+
+    case encodingF64:
+      std::memcpy (dest + i, src + 8*i, 8);
+      break;
+    };
+  }
+}
+
+void encode (Encoding encoding, const double* src, unsigned char* dest, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    switch (encoding)
+    {
+    case encodingU8:
+      dest[i] = (unsigned char) (roundToLong (clip (src[i] * 128, -128, 127)) + 128);
+      break;
+
+    case encodingS16:
+      {
+        const long v = roundToLong (clip (src[i] * 32768, -32768, 32767));
+        dest[2*i]   = (unsigned char) (v);
+        dest[2*i+1] = (unsigned char) (v >> 8);
+      }
+      break;
+
+    case encodingS24:
+      {
+        const long v = roundToLong (clip (src[i] * 8388608, -8388608, 8388607));
+        dest[3*i]   = (unsigned char) (v);
+        dest[3*i+1] = (unsigned char) (v >> 8);
+        dest[3*i+2] = (unsigned char) (v >> 16);
+      }
+      break;
+
+    case encodingS32:
+      {
+        const int v = int (roundToLong (
+          clip (src[i] * 2147483648., -2147483648., 2147483647.)));
+        std::memcpy (dest + 4*i, &v, 4);
+      }
+      break;
+
+    case encodingF32:
+      {
+        const float v = float (src[i]);
+        std::memcpy (dest + 4*i, &v, 4);
+      }
+      break;
+
+    case encodingF64:
+      std::memcpy (dest + 8*i, src + i, 8);
+      break;
+    };
+  }
+}
+
+unsigned int readU16 (const unsigned char* p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+unsigned int readU32 (const unsigned char* p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int) p[3] << 24);
+}
+
+bool isWave (const unsigned char* data, size_t size)
+{
+  return size >= 12 &&
+         std::memcmp (data, "RIFF", 4) == 0 &&
+         std::memcmp (data + 8, "WAVE", 4) == 0;
+}
+
+Layout parseWave (const unsigned char* data, size_t size)
+{
+  Layout layout;
+  bool haveFormat = false;
+  size_t pos = 12;
+
+  while (pos + 8 <= size)
+  {
+    const unsigned char* chunk = data + pos;
+    const size_t chunkSize = readU32 (chunk + 4);
+    pos += 8;
+
+    if (std::memcmp (chunk, "fmt ", 4) == 0)
+    {
+      if (chunkSize < 16 || pos + chunkSize > size)
+        throw std::runtime_error ("bad format chunk");
+
+      unsigned int format = readU16 (chunk + 8);
+      layout.numChannels = readU16 (chunk + 10);
+      layout.sampleRate = readU32 (chunk + 12);
+      const unsigned int bits = readU16 (chunk + 22);
+
+      // WAVE_FORMAT_EXTENSIBLE keeps the format in the sub format
+      if (format == 0xfffe && chunkSize >= 40)
+        format = readU16 (chunk + 32);
+
+      if (format == 1 && bits == 8)
+        layout.encoding = encodingU8;
+      else if (format == 1 && bits == 16)
+        layout.encoding = encodingS16;
+      else if (format == 1 && bits == 24)
+        layout.encoding = encodingS24;
+      else if (format == 1 && bits == 32)
+        layout.encoding = encodingS32;
+      else if (format == 3 && bits == 32)
+        layout.encoding = encodingF32;
+      else if (format == 3 && bits == 64)
+        layout.encoding = encodingF64;
+      else
+        throw std::runtime_error ("unsupported sample format");
+
+      haveFormat = true;
+    }
+    else if (std::memcmp (chunk, "data", 4) == 0)
+    {
+      if (!haveFormat || layout.numChannels < 1)
+        throw std::runtime_error ("data before format chunk");
+
+      // a truncated recording still has its complete frames
+      const size_t bytes = std::min (chunkSize, size - pos);
+      layout.dataOffset = pos;
+      layout.numFrames = bytes /
+        (bytesPerSample (layout.encoding) * layout.numChannels);
+      return layout;
+    }
+
+    pos += chunkSize + (chunkSize & 1);
+  }
+
+  throw std::runtime_error ("no data chunk");
+}
+
+//------------------------------------------------------------------------------
+
+// A whole file mapped into memory
+class MappedFile
+{
+public:
+  MappedFile ()
+    : m_fd (-1)
+    , m_data (0)
+    , m_size (0)
+  {
+  }
+
+  ~MappedFile ()
+  {
+    close ();
+  }
+
+  void openForReading (const std::string& path)
+  {
+    open (path, O_RDONLY);
+    map (PROT_READ, MAP_PRIVATE);
+  }
+
+  void openForUpdate (const std::string& path)
+  {
+    open (path, O_RDWR);
+    map (PROT_READ | PROT_WRITE, MAP_SHARED);
+  }
+
+  // Creates a new file from a mkstemp() template, which is replaced
+  // by the name of the file
+  void createUnique (std::string& path, size_t size)
+  {
+    std::vector<char> name (path.begin (), path.end ());
+    name.push_back (0);
+
+    m_fd = mkstemp (&name[0]);
+    if (m_fd == -1)
+      throw std::runtime_error ("can't create " + path);
+    path = &name[0];
+
+    if (fchmod (m_fd, 0644) != 0 || ftruncate (m_fd, off_t (size)) != 0)
+      throw std::runtime_error ("can't size " + path);
+    m_size = size;
+
+    map (PROT_READ | PROT_WRITE, MAP_SHARED);
+  }
+
+  // True if the open file is the one at path
+  bool isSameFile (const std::string& path) const
+  {
+    struct stat mine;
+    struct stat other;
+    return fstat (m_fd, &mine) == 0 &&
+           stat (path.c_str (), &other) == 0 &&
+           mine.st_dev == other.st_dev &&
+           mine.st_ino == other.st_ino;
+  }
+
+  void close ()
+  {
+    if (m_data)
+      munmap (m_data, m_size);
+    if (m_fd != -1)
+      ::close (m_fd);
+    m_fd = -1;
+    m_data = 0;
+    m_size = 0;
+  }
+
+  unsigned char* getData () const
+  {
+    return m_data;
+  }
+
+  size_t getSize () const
+  {
+    return m_size;
+  }
+
+private:
+  void open (const std::string& path, int flags)
+  {
+    m_fd = ::open (path.c_str (), flags);
+    if (m_fd == -1)
+      throw std::runtime_error ("can't open " + path);
+
+    struct stat info;
+    if (fstat (m_fd, &info) != 0)
+      throw std::runtime_error ("can't stat " + path);
+    m_size = size_t (info.st_size);
+  }
+
+  void map (int protection, int flags)
+  {
+    if (m_size == 0)
+      return;
+
+    void* p = mmap (0, m_size, protection, flags, m_fd, 0);
+    if (p == MAP_FAILED)
+      throw std::runtime_error ("can't map file");
+
+    m_data = static_cast<unsigned char*> (p);
+    madvise (m_data, m_size, MADV_SEQUENTIAL);
+  }
+
+private:
+  MappedFile (const MappedFile&);
+  MappedFile& operator= (const MappedFile&);
+
+private:
+  int m_fd;
+  unsigned char* m_data;
+  size_t m_size;
+};
+
+//------------------------------------------------------------------------------
+
+struct Options
+{
+  Options ()
+    : design (-1)
+    , state (1)
+    , inPlace (false)
+    , jobs (0)
+    , rawEncoding (encodingF32)
+    , rawFormat (false)
+    , rawChannels (1)
+    , rawRate (44100)
+    , list (false)
+  {
+  }
+
+  int design;
+  int state;
+  std::vector<std::pair<std::string, double> > params;
+  std::string outputDirectory;
+  bool inPlace;
+  int jobs;
+  Encoding rawEncoding;
+  bool rawFormat;
+  int rawChannels;
+  double rawRate;
+  bool list;
+  std::vector<std::string> files;
+};
+
+bool sameLabel (const char* a, const std::string& b)
+{
+  if (std::strlen (a) != b.size ())
+    return false;
+
+  for (size_t i = 0; i < b.size (); ++i)
+    if (std::tolower (a[i]) != std::tolower (b[i]))
+      return false;
+
+  return true;
+}
+
+// Creates the filter for one file and sets its parameters
+Dsp::Filter* createFilter (const Options& options, int numChannels, double sampleRate)
+{
+  std::unique_ptr<Dsp::Filter> f (designs[options.design].create (options.state, numChannels));
+
+  Dsp::Params params = f->getDefaultParams ();
+  const int rateIndex = f->findParamId (Dsp::idSampleRate);
+  if (rateIndex >= 0)
+    params[rateIndex] = sampleRate;
+
+  for (size_t i = 0; i < options.params.size (); ++i)
+  {
+    int index = -1;
+    for (int j = 0; j < f->getNumParams (); ++j)
+      if (sameLabel (f->getParamInfo (j).getLabel (), options.params[i].first))
+        index = j;
+
+    if (index < 0)
+      throw std::runtime_error ("the filter has no parameter " +
+                                options.params[i].first);
+
+    params[index] = options.params[i].second;
+  }
+
+  f->setParams (params);
+
+  return f.release ();
+}
+
+Layout findLayout (const Options& options, const unsigned char* src, size_t size)
+{
+  Layout layout;
+  if (size > 0 && isWave (src, size))
+  {
+    layout = parseWave (src, size);
+  }
+  else if (options.rawFormat)
+  {
+    layout.encoding = options.rawEncoding;
+    layout.numChannels = options.rawChannels;
+    layout.sampleRate = options.rawRate;
+    layout.dataOffset = 0;
+    layout.numFrames = size /
+      (bytesPerSample (layout.encoding) * layout.numChannels);
+  }
+  else
+  {
+    throw std::runtime_error ("not a WAV file, use --raw for raw files");
+  }
+
+  return layout;
+}
+
+void filter (const Layout& layout,
+             Dsp::Filter& f,
+             const unsigned char* src,
+             unsigned char* dest)
+{
+  const size_t frameBytes = bytesPerSample (layout.encoding) * layout.numChannels;
+  std::vector<double> buffer (size_t (blockFrames) * layout.numChannels);
+
+  for (size_t frame = 0; frame < layout.numFrames; frame += blockFrames)
+  {
+    const int n = int (std::min (layout.numFrames - frame, size_t (blockFrames)));
+    const size_t offset = layout.dataOffset + frame * frameBytes;
+    const size_t numSamples = size_t (n) * layout.numChannels;
+
+    decode (layout.encoding, src + offset, &buffer[0], numSamples);
+    f.processInterleaved (n, layout.numChannels, &buffer[0]);
+    encode (layout.encoding, &buffer[0], dest + offset, numSamples);
+  }
+}
+
+// The output is only created once the input has been understood and
+// the filter set up. It is written under a temporary name and renamed
+// into place when complete, so a failure leaves nothing behind and an
+// existing file is replaced all at once.
+void filterFile (const Options& options, const std::string& path)
+{
+  MappedFile input;
+
+  if (options.inPlace)
+    input.openForUpdate (path);
+  else
+    input.openForReading (path);
+
+  const unsigned char* src = input.getData ();
+  const size_t size = input.getSize ();
+
+  const Layout layout = findLayout (options, src, size);
+  std::unique_ptr<Dsp::Filter> f (
+    createFilter (options, layout.numChannels, layout.sampleRate));
+
+  if (options.inPlace)
+  {
+    filter (layout, *f, src, input.getData ());
+    return;
+  }
+
+  const size_t slash = path.find_last_of ('/');
+  const std::string name = slash == std::string::npos ?
+    path : path.substr (slash + 1);
+  const std::string outputPath = options.outputDirectory + "/" + name;
+
+  if (input.isSameFile (outputPath))
+    throw std::runtime_error ("the output would replace the input, use --in-place");
+
+  const std::string pattern = options.outputDirectory + "/." + name + ".XXXXXX";
+  std::string tempPath = pattern;
+  MappedFile output;
+
+  try
+  {
+    output.createUnique (tempPath, size);
+
+    // headers and trailing chunks are kept as they are
+    if (size > 0)
+      std::memcpy (output.getData (), src, size);
+
+    filter (layout, *f, src, output.getData ());
+    output.close ();
+
+    if (std::rename (tempPath.c_str (), outputPath.c_str ()) != 0)
+      throw std::runtime_error ("can't rename to " + outputPath);
+  }
+  catch (...)
+  {
+    output.close ();
+    if (tempPath != pattern)
+      std::remove (tempPath.c_str ());
+    throw;
+  }
+}
+
+//------------------------------------------------------------------------------
+
+bool parseOptions (int argc, char** argv, Options& options)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+
+    if (arg.compare (0, 2, "--") != 0)
+    {
+      options.files.push_back (arg);
+      continue;
+    }
+
+    if (arg == "--in-place")
+    {
+      options.inPlace = true;
+      continue;
+    }
+
+    if (arg == "--list")
+    {
+      options.list = true;
+      continue;
+    }
+
+    if (i + 1 >= argc)
+    {
+      std::fprintf (stderr, "missing value for %s\n", arg.c_str ());
+      return false;
+    }
+
+    const std::string value = argv[++i];
+
+    if (arg == "--filter")
+    {
+      for (int d = 0; d < numDesigns; ++d)
+        if (value == designs[d].name)
+          options.design = d;
+
+      if (options.design < 0)
+      {
+        std::fprintf (stderr, "unknown filter %s\n", value.c_str ());
+        return false;
+      }
+    }
+    else if (arg == "--param")
+    {
+      const size_t equals = value.find ('=');
+      if (equals == std::string::npos)
+      {
+        std::fprintf (stderr, "expected Label=value, got %s\n", value.c_str ());
+        return false;
+      }
+
+      options.params.push_back (std::make_pair (
+        value.substr (0, equals), std::atof (value.c_str () + equals + 1)));
+    }
+    else if (arg == "--state")
+    {
+      options.state = -1;
+      for (int s = 0; s < numStates; ++s)
+        if (value == stateNames[s])
+          options.state = s;
+
+      if (options.state < 0)
+      {
+        std::fprintf (stderr, "unknown state %s\n", value.c_str ());
+        return false;
+      }
+    }
+    else if (arg == "--output")
+      options.outputDirectory = value;
+    else if (arg == "--jobs")
+      options.jobs = std::atoi (value.c_str ());
+    else if (arg == "--channels")
+      options.rawChannels = std::atoi (value.c_str ());
+    else if (arg == "--rate")
+      options.rawRate = std::atof (value.c_str ());
+    else if (arg == "--raw")
+    {
+      options.rawFormat = true;
+      if (value == "s16")
+        options.rawEncoding = encodingS16;
+      else if (value == "s24")
+        options.rawEncoding = encodingS24;
+      else if (value == "s32")
+        options.rawEncoding = encodingS32;
+      else if (value == "f32")
+        options.rawEncoding = encodingF32;
+      else if (value == "f64")
+        options.rawEncoding = encodingF64;
+      else
+      {
+        std::fprintf (stderr, "unknown raw format %s\n", value.c_str ());
+        return false;
+      }
+    }
+    else
+    {
+      std::fprintf (stderr, "unknown option %s\n", arg.c_str ());
+      return false;
+    }
+  }
+
+  if (options.design < 0)
+  {
+    std::fprintf (stderr, "no --filter given\n");
+    return false;
+  }
+
+  if (options.list)
+    return true;
+
+  if (options.inPlace == !options.outputDirectory.empty ())
+  {
+    std::fprintf (stderr, "give either --output or --in-place\n");
+    return false;
+  }
+
+  if (options.rawChannels < 1)
+  {
+    std::fprintf (stderr, "bad channel count\n");
+    return false;
+  }
+
+  return true;
+}
+
+void listParams (const Options& options)
+{
+  std::unique_ptr<Dsp::Filter> f (designs[options.design].create (options.state, 1));
+
+  for (int i = 0; i < f->getNumParams (); ++i)
+  {
+    const Dsp::ParamInfo info = f->getParamInfo (i);
+    std::printf ("%-8s %-24s default %s\n", info.getLabel (), info.getName (),
+                 info.toString (info.getDefaultValue ()).c_str ());
+  }
+}
+
+}
+
+//------------------------------------------------------------------------------
+
+int main (int argc, char** argv)
+{
+  Options options;
+  if (!parseOptions (argc, argv, options))
+    return 1;
+
+  if (options.list)
+  {
+    listParams (options);
+    return 0;
+  }
+
+  int numJobs = options.jobs;
+  if (numJobs < 1)
+    numJobs = std::max (1, int (std::thread::hardware_concurrency ()));
+  numJobs = std::min (numJobs, int (options.files.size ()));
+
+  std::atomic<size_t> next (0);
+  std::atomic<int> numFailed (0);
+
+  // each worker takes the next file until there are none left
+  std::vector<std::thread> workers;
+  for (int j = 0; j < numJobs; ++j)
+  {
+    workers.push_back (std::thread ([&] ()
+    {
+      for (size_t i = next++; i < options.files.size (); i = next++)
+      {
+        try
+        {
+          filterFile (options, options.files[i]);
+        }
+        catch (std::exception& e)
+        {
+          std::fprintf (stderr, "%s: %s\n", options.files[i].c_str (), e.what ());
+          ++numFailed;
+        }
+      }
+    }));
+  }
+
+  for (size_t j = 0; j < workers.size (); ++j)
+    workers[j].join ();
+
+  return numFailed > 0 ? 1 : 0;
+}
@@ -40,8 +40,6 @@ AudioOutput::AudioOutput()
   , m_gain (1)
   , m_gainNext (1)
   , m_tempo (1)
-  , m_tempoNext (1)
-  , m_tempoSamplesFade (0)
 {
   m_filteringAudioSource = new FilteringAudioSource ();
 
@@ -89,7 +87,7 @@ void AudioOutput::setTempo (float tempo)
 
 void AudioOutput::setSource (AudioSource* source)
 {
-  ResamplingAudioSource* resampler = new ResamplingAudioSource (source, true);
+  RampingResampler* resampler = new RampingResampler (source);
   m_queue.call (bond (&AudioOutput::doSetSource, this, resampler));
 }
 
@@ -115,24 +113,22 @@ void AudioOutput::doSetGain (float gain)
 
 void AudioOutput::doSetTempo (float tempo)
 {
-  m_tempoNext = tempo;
+  m_tempo = tempo;
 
   if (m_device && m_resampler)
   {
     // fade over this many milliseconds
     const int msFade = 50;
 
-    m_tempoSamplesFade = int((ceil(m_device->getCurrentSampleRate() * msFade) + 999) / 1000);
-    if (m_tempoSamplesFade < 2)
-        m_tempoSamplesFade = 2;
-  }
-  else
-  {
-    m_tempo = tempo;
+    int samplesFade = int((ceil(m_device->getCurrentSampleRate() * msFade) + 999) / 1000);
+    if (samplesFade < 2)
+        samplesFade = 2;
+
+    m_resampler->setResamplingRatio (tempo, samplesFade);
   }
 }
 
-void AudioOutput::doSetSource (ResamplingAudioSource* source)
+void AudioOutput::doSetSource (RampingResampler* source)
 {
   m_resampler = source;
   m_resampler->setResamplingRatio (m_tempo);
@@ -183,41 +179,10 @@ void AudioOutput::audioDeviceIOCallback (const float** inputChannelData,
 
   info.buffer = &buffer;
 
+  // a tempo fade is ramped inside the resampler, sample by sample
   info.startSample = 0;
   info.numSamples = numSamples;
-  if (m_tempoSamplesFade > 0)
-  {
-    // tempo fade
-    float dt = (m_tempoNext - m_tempo) / m_tempoSamplesFade;
-    while (info.numSamples > 0)
-    {
-      // smallest step sounds best but uses the most CPU
-      const int step = 1; // increase to reduce CPU usage
-      int amount = jmin (step, info.numSamples);
-
-      AudioSourceChannelInfo b;
-      b.buffer = &buffer;
-      b.startSample = info.startSample;
-      b.numSamples = amount;
-      m_resampler->setResamplingRatio (m_tempo);
-      m_filteringAudioSource->getNextAudioBlock (b);
-
-      // advance
-      m_tempo += dt * amount;
-      m_tempoSamplesFade -= amount;
-      info.startSample += amount;
-      info.numSamples -= amount;
-    }
-
-    if (m_tempoSamplesFade == 0)
-    {
-      m_tempo = m_tempoNext;
-      m_resampler->setResamplingRatio (m_tempo);
-    }
-  }
-
-  if (info.numSamples > 0)
-    m_filteringAudioSource->getNextAudioBlock (info);
+  m_filteringAudioSource->getNextAudioBlock (info);
 
   // gain
   info.startSample = 0;
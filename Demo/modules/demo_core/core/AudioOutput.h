@@ -61,7 +61,7 @@ public:
 protected:
   void doSetGain (float gain);
   void doSetTempo (float tempo);
-  void doSetSource (ResamplingAudioSource* source);
+  void doSetSource (RampingResampler* source);
   void doSetFilter (Dsp::Filter* filter);
   void doSetFilterParameters (Dsp::Params parameters);
   void doResetFilter ();
@@ -81,12 +81,10 @@ private:
   ThreadQueue m_queue;
   AudioIODevice* m_device;
   ScopedPointer<FilteringAudioSource> m_filteringAudioSource;
-  ResamplingAudioSource* m_resampler;
+  RampingResampler* m_resampler;
   float m_gain;
   float m_gainNext;
   float m_tempo;
-  float m_tempoNext;
-  int m_tempoSamplesFade;
 };
 
 #endif
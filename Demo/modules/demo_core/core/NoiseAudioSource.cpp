@@ -33,53 +33,168 @@ THE SOFTWARE.
 
 *******************************************************************************/
 
-NoiseAudioSource::NoiseAudioSource (bool pink)
-  : m_pink (pink)
-  , m_random (Time::currentTimeMillis())
+void xorshift128::seed (uint64 seed)
 {
+  // splitmix64 spreads nearby seeds over the whole state
+  uint32 v[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    uint64 z = (seed += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    v[i] = uint32 ((z ^ (z >> 31)) >> 32);
+  }
+
+  x = v[0];
+  y = v[1];
+  z = v[2];
+  w = v[3] | 1; // the state must not be all zero
 }
 
-NoiseAudioSource::~NoiseAudioSource ()
+//------------------------------------------------------------------------------
+
+NoiseGenerator::NoiseGenerator (int maxChannels, uint32 seed, bool pink)
+  : m_seed (seed)
+  , m_pink (pink)
+  , m_generators (maxChannels)
+  , m_filters (maxChannels)
 {
+  reset ();
 }
 
-void NoiseAudioSource::prepareToPlay (int samplesPerBlockExpected,
-                                      double sampleRate)
+void NoiseGenerator::setSeed (uint32 seed)
 {
+  m_seed = seed;
+  reset ();
 }
 
-void NoiseAudioSource::releaseResources()
+void NoiseGenerator::setPink (bool pink)
 {
+  m_pink = pink;
 }
 
-void NoiseAudioSource::getNextAudioBlock (const AudioSourceChannelInfo& bufferToFill)
+void NoiseGenerator::reset ()
 {
-  if (m_pink)
-  {
-    for (int i = 0; i < bufferToFill.buffer->getNumChannels(); ++i)
-      pink_noise (bufferToFill.numSamples,
-                  bufferToFill.buffer->getArrayOfChannels()[i] + bufferToFill.startSample);
-  }
-  else
+  for (int i = 0; i < getMaxChannels (); ++i)
   {
-    for (int i = 0; i < bufferToFill.buffer->getNumChannels(); ++i)
-      white_noise (bufferToFill.numSamples,
-                   bufferToFill.buffer->getArrayOfChannels()[i] + bufferToFill.startSample);
+    m_generators[i].seed ((uint64 (m_seed) << 32) | uint32 (i));
+    m_filters[i] = pink_noise_filter ();
   }
 }
 
-void NoiseAudioSource::white_noise (int numSamples, float* dest)
+void NoiseGenerator::process (int numSamples, float* const* channels, int numChannels)
 {
-  while (--numSamples >= 0)
+  for (int i = getMaxChannels (); i < numChannels; ++i)
+    zeromem (channels[i], numSamples * sizeof (float));
+  numChannels = jmin (numChannels, getMaxChannels ());
+
+  int i = 0;
+  for (; i + 4 <= numChannels; i += 4)
+    white (numSamples, channels + i, &m_generators[i]);
+  for (; i < numChannels; ++i)
   {
-    *dest++ = (m_random.nextFloat()*2)-1;
+    xorshift128& g = m_generators[i];
+    for (int n = 0; n < numSamples; ++n)
+      channels[i][n] = xorshift128::toFloat (g.next ());
+  }
+
+  if (m_pink)
+  {
+    typedef Dsp::LaneVector <Dsp::maxLanes, double> vector_t;
+    typedef Dsp::LaneVector <1, double> scalar_t;
+
+    i = 0;
+    for (; i + vector_t::lanes <= numChannels; i += vector_t::lanes)
+      pink <vector_t> (numSamples, channels + i, &m_filters[i]);
+    for (; i < numChannels; ++i)
+      pink <scalar_t> (numSamples, channels + i, &m_filters[i]);
   }
 }
 
-void NoiseAudioSource::pink_noise (int numSamples, float* dest)
+// Four channels, one generator in each 32 bit lane
+void NoiseGenerator::white (int numSamples, float* const* channels, xorshift128* g)
 {
-  while (--numSamples >= 0)
+#if DSPFILTERS_SSE2
+  __m128i x = _mm_set_epi32 (g[3].x, g[2].x, g[1].x, g[0].x);
+  __m128i y = _mm_set_epi32 (g[3].y, g[2].y, g[1].y, g[0].y);
+  __m128i z = _mm_set_epi32 (g[3].z, g[2].z, g[1].z, g[0].z);
+  __m128i w = _mm_set_epi32 (g[3].w, g[2].w, g[1].w, g[0].w);
+
+  const __m128 scale = _mm_set1_ps (1.f / (1 << 22));
+  const __m128 one = _mm_set1_ps (1.f);
+
+  for (int n = 0; n < numSamples; ++n)
   {
-    *dest++ = m_filter.process ((m_random.nextFloat()*2)-1);
+    __m128i t = _mm_xor_si128 (x, _mm_slli_epi32 (x, 11));
+    x = y;
+    y = z;
+    z = w;
+    t = _mm_xor_si128 (t, _mm_srli_epi32 (t, 8));
+    w = _mm_xor_si128 (_mm_xor_si128 (w, _mm_srli_epi32 (w, 19)), t);
+
+    const __m128 v = _mm_sub_ps (_mm_mul_ps (_mm_cvtepi32_ps (_mm_srli_epi32 (w, 9)),
+                                             scale), one);
+    float f[4];
+    _mm_storeu_ps (f, v);
+    channels[0][n] = f[0];
+    channels[1][n] = f[1];
+    channels[2][n] = f[2];
+    channels[3][n] = f[3];
   }
+
+  uint32 s[4][4];
+  _mm_storeu_si128 (reinterpret_cast<__m128i*> (s[0]), x);
+  _mm_storeu_si128 (reinterpret_cast<__m128i*> (s[1]), y);
+  _mm_storeu_si128 (reinterpret_cast<__m128i*> (s[2]), z);
+  _mm_storeu_si128 (reinterpret_cast<__m128i*> (s[3]), w);
+  for (int l = 0; l < 4; ++l)
+  {
+    g[l].x = s[0][l];
+    g[l].y = s[1][l];
+    g[l].z = s[2][l];
+    g[l].w = s[3][l];
+  }
+#else
+  for (int n = 0; n < numSamples; ++n)
+    for (int l = 0; l < 4; ++l)
+      channels[l][n] = xorshift128::toFloat (g[l].next ());
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+NoiseAudioSource::NoiseAudioSource (bool pink)
+  : m_noise (maxChannels, uint32 (Time::currentTimeMillis()), pink)
+{
+}
+
+NoiseAudioSource::NoiseAudioSource (bool pink, uint32 seed)
+  : m_noise (maxChannels, seed, pink)
+{
+}
+
+NoiseAudioSource::~NoiseAudioSource ()
+{
+}
+
+void NoiseAudioSource::prepareToPlay (int samplesPerBlockExpected,
+                                      double sampleRate)
+{
+}
+
+void NoiseAudioSource::releaseResources()
+{
+}
+
+void NoiseAudioSource::getNextAudioBlock (const AudioSourceChannelInfo& bufferToFill)
+{
+  const int numChannels = bufferToFill.buffer->getNumChannels();
+  for (int i = maxChannels; i < numChannels; ++i)
+    bufferToFill.buffer->clear (i, bufferToFill.startSample, bufferToFill.numSamples);
+
+  const int numNoiseChannels = jmin (numChannels, int (maxChannels));
+  for (int i = 0; i < numNoiseChannels; ++i)
+    m_channels[i] = bufferToFill.buffer->getArrayOfChannels()[i] + bufferToFill.startSample;
+
+  m_noise.process (bufferToFill.numSamples, m_channels, numNoiseChannels);
 }
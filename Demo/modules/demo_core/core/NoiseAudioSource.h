@@ -49,38 +49,60 @@ THE SOFTWARE.
 // From
 // http://www.musicdsp.org/files/pink.txt
 //
-struct pink_noise_filter
+// Value may be a Dsp::LaneVector, to run one filter in each lane.
+//
+template <typename Value>
+struct basic_pink_noise_filter
 {
   // +/-0.05dB above 9.2Hz @ 44,100 Hz Fs
-  pink_noise_filter ()
+  basic_pink_noise_filter ()
+    : b0 (0.)
+    , b1 (0.)
+    , b2 (0.)
+    , b3 (0.)
+    , b4 (0.)
+    , b5 (0.)
+    , b6 (0.)
   {
-    b0 = 0;
-    b1 = 0;
-    b2 = 0;
-    b3 = 0;
-    b4 = 0;
-    b5 = 0;
-    b6 = 0;
   }
 
   template <typename Sample>
   inline Sample process (const Sample white)
   {
-    b0 = 0.99886 * b0 + white * 0.0555179;
-    b1 = 0.99332 * b1 + white * 0.0750759;
-    b2 = 0.96900 * b2 + white * 0.1538520;
-    b3 = 0.86650 * b3 + white * 0.3104856;
-    b4 = 0.55000 * b4 + white * 0.5329522;
-    b5 = -0.7616 * b5 - white * 0.0168980;
-    const double pink = b0 + b1 + b2 + b3 + b4 + b5 + b6 + white * 0.5362;
-    b6 = white * 0.115926;
+    const Value w (white);
+    b0 = Value (0.99886) * b0 + w * Value (0.0555179);
+    b1 = Value (0.99332) * b1 + w * Value (0.0750759);
+    b2 = Value (0.96900) * b2 + w * Value (0.1538520);
+    b3 = Value (0.86650) * b3 + w * Value (0.3104856);
+    b4 = Value (0.55000) * b4 + w * Value (0.5329522);
+    b5 = Value (-0.7616) * b5 - w * Value (0.0168980);
+    const Value pink = b0 + b1 + b2 + b3 + b4 + b5 + b6 + w * Value (0.5362);
+    b6 = w * Value (0.115926);
     return static_cast <Sample> (pink);
   }
 
-private:
-  double b0, b1, b2, b3, b4, b5, b6;
+  // Moves the state of a scalar filter into or out of a lane
+  template <class Filter>
+  void load (int lane, const Filter& f)
+  {
+    b0.set (lane, f.b0); b1.set (lane, f.b1); b2.set (lane, f.b2);
+    b3.set (lane, f.b3); b4.set (lane, f.b4); b5.set (lane, f.b5);
+    b6.set (lane, f.b6);
+  }
+
+  template <class Filter>
+  void store (int lane, Filter& f) const
+  {
+    f.b0 = b0.get (lane); f.b1 = b1.get (lane); f.b2 = b2.get (lane);
+    f.b3 = b3.get (lane); f.b4 = b4.get (lane); f.b5 = b5.get (lane);
+    f.b6 = b6.get (lane);
+  }
+
+  Value b0, b1, b2, b3, b4, b5, b6;
 };
 
+typedef basic_pink_noise_filter <double> pink_noise_filter;
+
 struct fast_pink_noise_filter
 {
   // +/-0.5dB above 9.2Hz @ 44,100 Hz Fs
@@ -107,10 +129,110 @@ private:
 
 //------------------------------------------------------------------------------
 
+//
+// Marsaglia's xorshift128. Only shifts and exclusive ors, so
+// four generators run side by side in the lanes of an SSE2 register.
+//
+struct xorshift128
+{
+  void seed (uint64 seed);
+
+  inline uint32 next ()
+  {
+    const uint32 t = x ^ (x << 11);
+    x = y;
+    y = z;
+    z = w;
+    w = w ^ (w >> 19) ^ (t ^ (t >> 8));
+    return w;
+  }
+
+  // Uniform in [-1, 1) from the top 23 bits
+  static inline float toFloat (uint32 v)
+  {
+    return float (int (v >> 9)) * (1.f / (1 << 22)) - 1.f;
+  }
+
+  uint32 x, y, z, w;
+};
+
+//------------------------------------------------------------------------------
+
+/*
+ * Block noise generator for any number of channels.
+ *
+ * Every channel has a generator of its own, seeded from the seed and
+ * the channel's index, so each channel's noise can be reproduced on
+ * its own whatever the number of channels or the size of the blocks.
+ * White noise is made four channels at a time, and pink noise filters
+ * a group of channels at once, one in each lane of a Dsp::LaneVector.
+ *
+ * The state of every channel is allocated up front, for maxChannels,
+ * so process() never allocates and can run on the audio thread.
+ *
+ */
+class NoiseGenerator
+{
+public:
+  NoiseGenerator (int maxChannels, uint32 seed = 0, bool pink = false);
+
+  int getMaxChannels () const
+  {
+    return int (m_generators.size ());
+  }
+
+  void setSeed (uint32 seed);
+  void setPink (bool pink);
+
+  // Starts every channel over from its seed
+  void reset ();
+
+  // Channels past getMaxChannels() are cleared
+  void process (int numSamples, float* const* channels, int numChannels);
+
+private:
+  void white (int numSamples, float* const* channels, xorshift128* generators);
+
+  template <class Vector>
+  void pink (int numSamples, float* const* channels, pink_noise_filter* filters)
+  {
+    basic_pink_noise_filter <Vector> lanes;
+    for (int l = 0; l < Vector::lanes; ++l)
+      lanes.load (l, filters[l]);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+      Vector v;
+      v.load (channels, i);
+      v = lanes.process (v);
+      v.store (channels, i);
+    }
+
+    for (int l = 0; l < Vector::lanes; ++l)
+      lanes.store (l, filters[l]);
+  }
+
+private:
+  uint32 m_seed;
+  bool m_pink;
+  std::vector<xorshift128> m_generators;
+  std::vector<pink_noise_filter> m_filters;
+};
+
+//------------------------------------------------------------------------------
+
 class NoiseAudioSource : public AudioSource
 {
 public:
+  enum
+  {
+    // Channels beyond this are silent
+    maxChannels = 32
+  };
+
+  // Seeded from the clock
   explicit NoiseAudioSource (bool pink = false);
+  NoiseAudioSource (bool pink, uint32 seed);
   ~NoiseAudioSource ();
 
   void prepareToPlay (int samplesPerBlockExpected,
@@ -120,13 +242,9 @@ public:
 
   void getNextAudioBlock (const AudioSourceChannelInfo& bufferToFill);
 
-  void white_noise (int numSamples, float* dest);
-  void pink_noise (int numSamples, float* dest);
-  
 private:
-  bool m_pink;
-  Random m_random;
-  pink_noise_filter m_filter;
+  NoiseGenerator m_noise;
+  float* m_channels[maxChannels];
 };
 
 #endif
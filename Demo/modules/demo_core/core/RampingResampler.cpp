@@ -0,0 +1,255 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+RampingResampler::RampingResampler (AudioSource* source, int numChannels)
+  : m_source (source)
+  , m_numChannels (numChannels)
+  , m_ratio (1)
+  , m_ratioTarget (1)
+  , m_rampSamples (0)
+  , m_buffer (numChannels, 0)
+  , m_bufferPos (0)
+  , m_bufferSamples (0)
+  , m_subSampleOffset (0)
+  , m_lowPassRatio (0)
+{
+  jassert (source != 0);
+
+  m_lowPass.calloc (size_t (m_numChannels));
+  designLowPass (1);
+}
+
+RampingResampler::~RampingResampler ()
+{
+}
+
+void RampingResampler::setResamplingRatio (double ratio, int rampSamples)
+{
+  jassert (ratio > 0);
+
+  m_ratioTarget = ratio;
+  m_rampSamples = jmax (0, rampSamples);
+  if (m_rampSamples == 0)
+    m_ratio = ratio;
+}
+
+double RampingResampler::getResamplingRatio () const
+{
+  return m_ratioTarget;
+}
+
+void RampingResampler::prepareToPlay (int samplesPerBlockExpected,
+                                      double sampleRate)
+{
+  m_source->prepareToPlay (samplesPerBlockExpected, sampleRate);
+
+  m_buffer.setSize (m_numChannels,
+                    roundToInt (samplesPerBlockExpected * jmax (m_ratio, m_ratioTarget)) + 32);
+  m_buffer.clear ();
+  m_bufferPos = 0;
+  m_bufferSamples = 0;
+  m_subSampleOffset = 0;
+
+  m_lowPass.clear (size_t (m_numChannels));
+  designLowPass (m_ratio);
+}
+
+void RampingResampler::releaseResources()
+{
+  m_source->releaseResources ();
+  m_buffer.setSize (m_numChannels, 0);
+  m_bufferPos = 0;
+  m_bufferSamples = 0;
+}
+
+void RampingResampler::getNextAudioBlock (const AudioSourceChannelInfo& bufferToFill)
+{
+  const int numSamples = bufferToFill.numSamples;
+  const int numChannels = jmin (m_numChannels, bufferToFill.buffer->getNumChannels ());
+
+  // the ratio goes up by step for the first rampSamples outputs,
+  // then holds at endRatio for the rest of the block
+  const int rampSamples = jmin (m_rampSamples, numSamples);
+  const double startRatio = m_ratio;
+  const double step = m_rampSamples > 0 ? (m_ratioTarget - m_ratio) / m_rampSamples : 0;
+  const double endRatio = rampSamples < m_rampSamples ? startRatio + step * rampSamples
+                                                      : m_ratioTarget;
+
+  // anti-aliasing for the end of the block furthest from unity
+  const double filterRatio = std::fabs (startRatio - 1) > std::fabs (endRatio - 1) ? startRatio
+                                                                                   : endRatio;
+  const bool preFilter = filterRatio > 1.0001;
+  const bool postFilter = filterRatio < 0.9999;
+  if (filterRatio != m_lowPassRatio)
+    designLowPass (filterRatio);
+
+  // input consumed by the block, plus the sample after it for interpolation
+  const double advance = rampSamples * startRatio
+                       + step * rampSamples * (rampSamples - 1) / 2
+                       + (numSamples - rampSamples) * endRatio;
+  readInput (int (std::ceil (m_subSampleOffset + advance)) + 2, preFilter);
+
+  float* dest[32];
+  const float* src[32];
+  jassert (numChannels <= 32);
+  for (int i = 0; i < numChannels; ++i)
+  {
+    dest[i] = bufferToFill.buffer->getSampleData (i, bufferToFill.startSample);
+    src[i] = m_buffer.getSampleData (i, 0);
+  }
+
+  int pos = m_bufferPos;
+  double offset = m_subSampleOffset;
+  for (int n = 0; n < numSamples; ++n)
+  {
+    const float alpha = float (offset);
+    const float invAlpha = 1.f - alpha;
+
+    jassert (pos + 1 < m_bufferSamples);
+    for (int i = 0; i < numChannels; ++i)
+      dest[i][n] = src[i][pos] * invAlpha + src[i][pos + 1] * alpha;
+
+    offset += n < rampSamples ? startRatio + step * n : endRatio;
+    while (offset >= 1)
+    {
+      ++pos;
+      offset -= 1;
+    }
+  }
+
+  m_bufferPos = pos;
+  m_subSampleOffset = offset;
+  m_ratio = endRatio;
+  m_rampSamples -= rampSamples;
+
+  if (postFilter)
+  {
+    for (int i = 0; i < numChannels; ++i)
+      applyLowPass (dest[i], numSamples, m_lowPass[i]);
+  }
+  else if (!preFilter && numSamples > 0)
+  {
+    // keep the unused filter primed with the latest output, so
+    // that it can take over without a discontinuity
+    for (int i = 0; i < numChannels; ++i)
+    {
+      LowPass& state = m_lowPass[i];
+      const float* end = dest[i] + numSamples - 1;
+      if (numSamples > 1)
+      {
+        state.x2 = state.y2 = end[-1];
+      }
+      else
+      {
+        state.x2 = state.x1;
+        state.y2 = state.y1;
+      }
+      state.x1 = state.y1 = end[0];
+    }
+  }
+
+  for (int i = numChannels; i < bufferToFill.buffer->getNumChannels (); ++i)
+    bufferToFill.buffer->clear (i, bufferToFill.startSample, numSamples);
+}
+
+// Makes numSamples of input available from m_bufferPos on, after moving
+// what is left of the previous block to the front of the buffer.
+void RampingResampler::readInput (int numSamples, bool preFilter)
+{
+  const int remaining = m_bufferSamples - m_bufferPos;
+  if (m_bufferPos > 0)
+  {
+    for (int i = 0; i < m_numChannels; ++i)
+    {
+      float* data = m_buffer.getSampleData (i, 0);
+      memmove (data, data + m_bufferPos, size_t (remaining) * sizeof (float));
+    }
+    m_bufferPos = 0;
+    m_bufferSamples = remaining;
+  }
+
+  if (numSamples > m_buffer.getNumSamples ())
+    m_buffer.setSize (m_numChannels, numSamples + 32, true, false, true);
+
+  if (numSamples > m_bufferSamples)
+  {
+    const int numToRead = numSamples - m_bufferSamples;
+    AudioSourceChannelInfo info (&m_buffer, m_bufferSamples, numToRead);
+    m_source->getNextAudioBlock (info);
+
+    if (preFilter)
+    {
+      for (int i = 0; i < m_numChannels; ++i)
+        applyLowPass (m_buffer.getSampleData (i, m_bufferSamples), numToRead, m_lowPass[i]);
+    }
+
+    m_bufferSamples = numSamples;
+  }
+}
+
+void RampingResampler::designLowPass (double ratio)
+{
+  const double proportionalRate = ratio > 1 ? 0.5 / ratio : 0.5 * ratio;
+  const double n = 1 / std::tan (double_Pi * jmax (0.001, proportionalRate));
+  const double n2 = n * n;
+  const double c1 = 1 / (1 + std::sqrt (2.) * n + n2);
+
+  m_coefficients[0] = c1;
+  m_coefficients[1] = 2 * c1;
+  m_coefficients[2] = c1;
+  m_coefficients[3] = 2 * c1 * (1 - n2);
+  m_coefficients[4] = c1 * (1 - std::sqrt (2.) * n + n2);
+  m_lowPassRatio = ratio;
+}
+
+void RampingResampler::applyLowPass (float* samples, int numSamples, LowPass& state)
+{
+  const double* c = m_coefficients;
+  for (int i = 0; i < numSamples; ++i)
+  {
+    const double in = samples[i];
+    double out = c[0] * in + c[1] * state.x1 + c[2] * state.x2
+                           - c[3] * state.y1 - c[4] * state.y2;
+    if (!(out < -1e-8 || out > 1e-8))
+      out = 0;
+
+    state.x2 = state.x1;
+    state.x1 = in;
+    state.y2 = state.y1;
+    state.y1 = out;
+
+    samples[i] = float (out);
+  }
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPDEMO_RAMPINGRESAMPLER_H
+#define DSPDEMO_RAMPINGRESAMPLER_H
+
+/*
+ * Resamples an AudioSource by a ratio which can glide from one
+ * value to another over a given number of output samples.
+ *
+ * The ratio advances at every output sample inside one resampling
+ * pass, so a block in the middle of a ramp costs the same as any
+ * other: one read from the input and one pass of interpolation.
+ * Interpolation is linear, with a two pole low pass against aliasing,
+ * designed once per block for the ratio furthest from unity. The
+ * ratio is only touched from the audio thread, so there is no lock.
+ *
+ */
+class RampingResampler : public AudioSource
+{
+public:
+  // The input is deleted with this object.
+  RampingResampler (AudioSource* source, int numChannels = 2);
+  ~RampingResampler ();
+
+  // Input samples per output sample. The ratio moves from its
+  // current value in a straight line over rampSamples, starting
+  // with the next block.
+  void setResamplingRatio (double ratio, int rampSamples = 0);
+
+  double getResamplingRatio () const;
+
+  void prepareToPlay (int samplesPerBlockExpected,
+                      double sampleRate);
+
+  void releaseResources();
+
+  void getNextAudioBlock (const AudioSourceChannelInfo& bufferToFill);
+
+private:
+  struct LowPass
+  {
+    double x1, x2, y1, y2;
+  };
+
+  void designLowPass (double ratio);
+  void applyLowPass (float* samples, int numSamples, LowPass& state);
+  void readInput (int numSamples, bool preFilter);
+
+private:
+  ScopedPointer<AudioSource> m_source;
+  const int m_numChannels;
+  double m_ratio;
+  double m_ratioTarget;
+  int m_rampSamples;
+  AudioSampleBuffer m_buffer;
+  int m_bufferPos;
+  int m_bufferSamples;
+  double m_subSampleOffset;
+  double m_lowPassRatio;
+  double m_coefficients[5];
+  HeapBlock<LowPass> m_lowPass;
+};
+
+#endif
@@ -35,9 +35,15 @@ THE SOFTWARE.
 
 ThreadQueue::ThreadQueue ()
   : m_isClosed (false)
-  , m_head (0)
-  , m_tail (0)
+  , m_writeBlock (new Block)
+  , m_reclaimBlock (m_writeBlock)
+  , m_spareBlock (0)
+  , m_reclaimed (0)
+  , m_written (0)
+  , m_readBlock (m_writeBlock)
+  , m_processed (0)
 {
+  m_writeBlock->next = 0;
 }
 
 ThreadQueue::~ThreadQueue ()
@@ -46,7 +52,18 @@ ThreadQueue::~ThreadQueue ()
   jassert (m_isClosed);
 
   // forgot to call process()
-  jassert (!m_head && !m_tail);
+  jassert (m_processed.get() == m_written.get());
+
+  reclaim ();
+
+  for (Block* block = m_reclaimBlock; block;)
+  {
+    Block* next = block->next;
+    delete block;
+    block = next;
+  }
+
+  delete m_spareBlock;
 }
 
 void ThreadQueue::open ()
@@ -61,30 +78,32 @@ void ThreadQueue::close ()
 
 void ThreadQueue::process ()
 {
-  Element* head;
-
-  // get the list
-  lock ();
-  head = m_head;
-  m_head = 0;
-  m_tail = 0;
-  if (head)
-    reset();
-  unlock ();
+  uint32 processed = m_processed.get();
+  uint32 written = m_written.get();
 
-  // process it
-  if (head)
+  if (written != processed)
   {
-    for (Element* cur = head; cur; cur = cur->m_next)
-      cur->operator ()();
+    reset();
 
-    // free
-    for (Element* cur = head; cur;)
+    // Calls put while these run are taken too, since put() only
+    // signals when it finds the queue empty
+    do
     {
-      Element* next = cur->m_next;
-      delete cur;
-      cur = next;
+      for (; processed != written; ++processed)
+      {
+        slot (m_readBlock, processed)->operator ()();
+
+        // the next block was linked before this slot was published
+        if (((processed + 1) & (numSlots - 1)) == 0)
+          m_readBlock = m_readBlock->next;
+      }
+
+      // hand the packets back to be destroyed
+      m_processed.set (processed);
+
+      written = m_written.get();
     }
+    while (written != processed);
   }
 }
 
@@ -96,29 +115,69 @@ void ThreadQueue::reset ()
 {
 }
 
-void ThreadQueue::lock ()
+ThreadQueue::Element* ThreadQueue::slot (Block* block, uint32 index)
 {
-  m_mutex.enter();
+  return reinterpret_cast<Element*> (block->slots[index & (numSlots - 1)].storage);
 }
 
-void ThreadQueue::unlock ()
+void ThreadQueue::reclaim ()
 {
-  m_mutex.exit();
+  const uint32 processed = m_processed.get();
+
+  for (; m_reclaimed != processed; ++m_reclaimed)
+  {
+    slot (m_reclaimBlock, m_reclaimed)->~Element();
+
+    // the processing thread has moved on, keep one block for reuse
+    if (((m_reclaimed + 1) & (numSlots - 1)) == 0)
+    {
+      Block* block = m_reclaimBlock;
+      m_reclaimBlock = block->next;
+
+      if (m_spareBlock)
+        delete block;
+      else
+        m_spareBlock = block;
+    }
+  }
 }
 
-void ThreadQueue::put (Element* element)
+void* ThreadQueue::allocate ()
 {
-  lock ();
   jassert (!m_isClosed);
-  bool shouldSignal = !m_head;
-  element->m_next = 0;
-  element->m_prev = m_tail;
-  if (element->m_prev)
-    element->m_prev->m_next = element;
-  else
-    m_head = element;
-  m_tail = element;
-  if (shouldSignal)
+
+  reclaim ();
+
+  return slot (m_writeBlock, m_written.get());
+}
+
+void ThreadQueue::put (Element* element)
+{
+  const uint32 written = m_written.get();
+  jassert (element == slot (m_writeBlock, written));
+
+  // This fills the block, so link another one for the next call
+  // before the processing thread can reach the end of this one.
+  if (((written + 1) & (numSlots - 1)) == 0)
+  {
+    Block* block = m_spareBlock;
+    if (block)
+      m_spareBlock = 0;
+    else
+      block = new Block;
+
+    block->next = 0;
+    m_writeBlock->next = block;
+    m_writeBlock = block;
+  }
+
+  // publish the packet
+  m_written.set (written + 1);
+
+  // Only signal a queue which was empty. Checking after publishing
+  // closes the race with a process() that is just finishing: either
+  // it sees this packet when it looks again, or it has already
+  // caught up and this sees that.
+  if (m_processed.get() == written)
     signal ();
-  unlock();
 }
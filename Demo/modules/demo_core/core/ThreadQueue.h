@@ -39,17 +39,35 @@ THE SOFTWARE.
 // Thread Queue
 // Easy to understand, powerful to use.
 // Concept, design, and implementation by Vinnie Falco.
+//
+// Calls are put by one thread and processed by one other thread,
+// through blocks of preallocated slots. Neither side takes a lock,
+// and process() never allocates or frees memory, so the queue can
+// feed an audio callback. Packets which were processed are destroyed
+// by the putting thread, the next time it makes a call.
+//
+// A block which was processed is kept for reuse, so once the queue
+// has warmed up, calls don't allocate either. When the processing
+// thread falls behind, or never runs because there is no audio
+// device, the putting thread links in another block from the heap
+// instead of waiting for it.
 class ThreadQueue
 {
 private:
+  enum
+  {
+    // Slots in a block, must be a power of two
+    numSlots = 256,
+
+    // Largest packet which fits in a slot
+    slotBytes = 128
+  };
+
   class Element
   {
   public:
     virtual ~Element() { }
     virtual void operator()() = 0;
-
-    Element* m_next;
-    Element* m_prev;
   };
 
   template<class Function>
@@ -67,6 +85,21 @@ private:
     Function m_function;
   };
 
+  union Slot
+  {
+    double alignDouble;
+    void* alignPointer;
+    char storage [slotBytes];
+  };
+
+  struct Block
+  {
+    Slot slots [numSlots];
+
+    // Linked before the last slot of this block is published
+    Block* next;
+  };
+
 public:
   ThreadQueue ();
   ~ThreadQueue ();
@@ -78,7 +111,9 @@ public:
   template<class Function>
   void call (const Function& function)
   {
-    put (new Packet<Function> (function));
+    static_jassert (sizeof (Packet<Function>) <= slotBytes);
+
+    put (new (allocate ()) Packet<Function> (function));
   }
 
 protected:
@@ -86,16 +121,24 @@ protected:
   virtual void reset ();
 
 private:
-  void lock ();
-  void unlock ();
-
+  static Element* slot (Block* block, uint32 index);
+  void reclaim ();
+  void* allocate ();
   void put (Element* element);
 
 private:
-  CriticalSection m_mutex;
   bool m_isClosed;
-  Element* m_head;
-  Element* m_tail;
+
+  // Only the putting thread changes these
+  Block* m_writeBlock;
+  Block* m_reclaimBlock;
+  Block* m_spareBlock;
+  uint32 m_reclaimed;
+  Atomic<uint32> m_written;
+
+  // Only the processing thread changes these
+  Block* m_readBlock;
+  Atomic<uint32> m_processed;
 };
 
 #endif
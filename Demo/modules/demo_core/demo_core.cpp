@@ -45,6 +45,7 @@ THE SOFTWARE.
 #include "core/AudioOutput.cpp"
 #include "core/FilteringAudioSource.cpp"
 #include "core/NoiseAudioSource.cpp"
+#include "core/RampingResampler.cpp"
 #include "core/ResamplingReader.cpp"
 #include "core/ThreadQueue.cpp"
 
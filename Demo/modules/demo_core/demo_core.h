@@ -54,6 +54,7 @@ using namespace juce;
 
 #include "core/bond.h"
 #include "core/FilteringAudioSource.h"
+#include "core/RampingResampler.h"
 #include "core/ThreadQueue.h"
 
 #include "core/AudioOutput.h"
@@ -44,6 +44,7 @@ THE SOFTWARE.
 #endif
 
 #include "gui/BrickWallChart.cpp"
+#include "gui/ChartWorker.cpp"
 #include "gui/CpuMeter.cpp"
 #include "gui/FilterChart.cpp"
 #include "gui/FilterControls.cpp"
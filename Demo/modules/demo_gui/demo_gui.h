@@ -56,6 +56,7 @@ THE SOFTWARE.
 #include "gui/SliderGroup.h"
 
 #include "gui/BrickWallChart.h"
+#include "gui/ChartWorker.h"
 #include "gui/ContentComponentConstrainer.h"
 #include "gui/CpuMeter.h"
 #include "gui/FilterControls.h"
@@ -37,9 +37,8 @@ THE SOFTWARE.
 
 //------------------------------------------------------------------------------
 
-BrickWallChart::BrickWallChart (FilterListeners& listeners)
-  : FrequencyChart (listeners)
-  , m_scale_y (1)
+BrickWallChart::BrickWallChart (ChartWorker& worker)
+  : FrequencyChart (worker)
 {
 }
 
@@ -83,52 +82,55 @@ void BrickWallChart::paintContents (Graphics& g)
 
   // path
   g.setColour (Colours::blue);
-  g.strokePath (m_path, 1, t);
+  g.strokePath (m_contents->path, 1, t);
 }
 
-void BrickWallChart::update ()
+FilterChart::Contents* BrickWallChart::calculate (Dsp::Filter* filter,
+                                                  const Rectangle<int>& bounds)
 {
-  m_isDefined = false;
-  m_path.clear();
+  Contents* contents = new Contents;
+  Path& path = contents->path;
+  bool& isDefined = contents->isDefined;
 
-  if (m_filter)
+  if (filter)
   {
-    m_isDefined = true;
+    isDefined = true;
 
-    const Rectangle<int> bounds = getLocalBounds ();
     const Rectangle<int> r = bounds.reduced (4, 4);
 
+    std::vector<double> freq (r.getWidth());
+    std::vector<double> mag (r.getWidth());
+    for (int xi = 0; xi < r.getWidth(); ++xi )
+      freq[xi] = xToF (xi / float(r.getWidth())) / 2.f;
+    if (r.getWidth() > 0)
+      filter->response (Dsp::FrequencyResponse::magnitude,
+                        r.getWidth(), &freq[0], &mag[0]);
+
     for (int xi = 0; xi < r.getWidth(); ++xi )
     {
       float x = xi / float(r.getWidth()); // [0..1)
-      float f = xToF (x);
-
-      Dsp::complex_t c = m_filter->response (f/2.f);
-      float y = float (std::abs(c));
+      float y = float (mag[xi]);
 
       if (!Dsp::is_nan (y))
       {
         if (xi == 0)
-          m_path.startNewSubPath (x, y);
+          path.startNewSubPath (x, y);
         else
-          m_path.lineTo (x, y);
+          path.lineTo (x, y);
       }
       else
       {
-        m_path.clear ();
-        m_isDefined = false;
+        path.clear ();
+        isDefined = false;
         break;
       }
     }
 
-    if (m_isDefined)
-      m_path.startNewSubPath (0, 0);
+    if (isDefined)
+      path.startNewSubPath (0, 0);
   }
 
-  float yh = m_path.getBounds().getHeight();
-  m_scale_y = (yh > MARGIN) ? (1/yh) : (1/MARGIN);
-
-  repaint();
+  return contents;
 }
 
 AffineTransform BrickWallChart::calcTransform ()
@@ -136,13 +138,16 @@ AffineTransform BrickWallChart::calcTransform ()
   const Rectangle<int> bounds = getLocalBounds ();
   const Rectangle<int> r = bounds.reduced (4, 4);
 
+  const float yh = m_contents->path.getBounds().getHeight();
+  const float scale_y = (yh > MARGIN) ? (1/yh) : (1/MARGIN);
+
   AffineTransform t;
 
   // scale x from 0..1 to 0..getWidth(), and flip vertical
   t = AffineTransform::scale (float(r.getWidth()), -1.f);
 
   // scale y from gain to 0..1 bounds in r
-  t = t.scaled (1.f, m_scale_y);
+  t = t.scaled (1.f, scale_y);
 
   // scale y from 0..1 to getHeight()
   t = t.scaled (1.f, float(r.getHeight()));
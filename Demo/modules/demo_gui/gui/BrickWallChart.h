@@ -44,7 +44,7 @@ THE SOFTWARE.
 class BrickWallChart : public FrequencyChart
 {
 public:
-  BrickWallChart (FilterListeners& listeners);
+  BrickWallChart (ChartWorker& worker);
 
   const String getName () const;
 
@@ -52,13 +52,10 @@ public:
 
   void paintContents (Graphics& g);
 
-private:
-  void update ();
-  AffineTransform calcTransform ();
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
 
 private:
-  float m_scale_y;
-  Path m_path;
+  AffineTransform calcTransform ();
 };
 
 #endif
@@ -0,0 +1,257 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+ChartWorker::ChartWorker ()
+  : Thread ("Chart Worker")
+  , m_newFilter (0)
+  , m_generation (0)
+{
+  m_params.clear ();
+
+  startThread ();
+}
+
+ChartWorker::~ChartWorker ()
+{
+  stopThread (-1);
+
+  // charts remove themselves before the worker goes away
+  jassert (m_charts.size () == 0);
+
+  delete m_newFilter;
+}
+
+void ChartWorker::addChart (FilterChart* chart)
+{
+  const ScopedLock lock (m_mutex);
+
+  Chart c;
+  c.chart = chart;
+  c.isDirty = false;
+  c.result = 0;
+  m_charts.add (c);
+}
+
+void ChartWorker::removeChart (FilterChart* chart)
+{
+  // waits for a calculation of this chart to finish
+  const ScopedLock calculateLock (m_calculateMutex);
+  const ScopedLock lock (m_mutex);
+
+  const int index = indexOf (chart);
+  if (index != -1)
+  {
+    delete m_charts.getReference (index).result;
+    m_charts.remove (index);
+  }
+}
+
+void ChartWorker::setFilter (Dsp::Filter* filter)
+{
+  {
+    const ScopedLock lock (m_mutex);
+
+    delete m_newFilter;
+    m_newFilter = filter;
+    m_params = filter->getParams ();
+    ++m_generation;
+    setAllDirty ();
+  }
+
+  notify ();
+}
+
+void ChartWorker::setParams (const Dsp::Params& params)
+{
+  {
+    const ScopedLock lock (m_mutex);
+
+    m_params = params;
+    ++m_generation;
+    setAllDirty ();
+  }
+
+  notify ();
+}
+
+void ChartWorker::setBounds (FilterChart* chart, const Rectangle<int>& bounds)
+{
+  {
+    const ScopedLock lock (m_mutex);
+
+    const int index = indexOf (chart);
+    if (index != -1)
+    {
+      Chart& c = m_charts.getReference (index);
+      c.bounds = bounds;
+      c.isDirty = true;
+    }
+  }
+
+  notify ();
+}
+
+int ChartWorker::indexOf (FilterChart* chart) const
+{
+  for (int i = 0; i < m_charts.size (); ++i)
+    if (m_charts.getReference (i).chart == chart)
+      return i;
+
+  return -1;
+}
+
+void ChartWorker::setAllDirty ()
+{
+  for (int i = 0; i < m_charts.size (); ++i)
+    m_charts.getReference (i).isDirty = true;
+}
+
+void ChartWorker::run ()
+{
+  // the generation of the parameters in m_filter
+  int applied = -1;
+
+  // charts are taken in turn, so that all of them keep
+  // up while the parameters change faster than they finish
+  int next = 0;
+
+  while (!threadShouldExit ())
+  {
+    Dsp::Filter* newFilter;
+    Dsp::Params params;
+    int generation;
+    FilterChart* chart = 0;
+    Rectangle<int> bounds;
+
+    {
+      const ScopedLock lock (m_mutex);
+
+      newFilter = m_newFilter;
+      m_newFilter = 0;
+      params = m_params;
+      generation = m_generation;
+
+      for (int i = 0; i < m_charts.size (); ++i)
+      {
+        const int index = (next + i) % m_charts.size ();
+        Chart& c = m_charts.getReference (index);
+        if (c.isDirty)
+        {
+          c.isDirty = false;
+          chart = c.chart;
+          bounds = c.bounds;
+          next = index + 1;
+          break;
+        }
+      }
+    }
+
+    if (newFilter)
+    {
+      m_filter = newFilter;
+      applied = -1;
+    }
+
+    if (!chart)
+    {
+      wait (-1);
+      continue;
+    }
+
+    if (m_filter && applied != generation)
+    {
+      m_filter->setParams (params);
+      applied = generation;
+    }
+
+    FilterChart::Contents* contents = 0;
+
+    {
+      const ScopedLock calculateLock (m_calculateMutex);
+
+      bool isAdded;
+      {
+        const ScopedLock lock (m_mutex);
+        isAdded = indexOf (chart) != -1;
+      }
+
+      if (isAdded)
+        contents = chart->calculate (m_filter, bounds);
+    }
+
+    {
+      const ScopedLock lock (m_mutex);
+
+      // a result which was not painted yet is replaced by the newer one
+      const int index = indexOf (chart);
+      if (index != -1)
+      {
+        Chart& c = m_charts.getReference (index);
+        delete c.result;
+        c.result = contents;
+        contents = 0;
+      }
+    }
+
+    delete contents;
+
+    triggerAsyncUpdate ();
+  }
+}
+
+void ChartWorker::handleAsyncUpdate ()
+{
+  Array<Chart> finished;
+
+  {
+    const ScopedLock lock (m_mutex);
+
+    for (int i = 0; i < m_charts.size (); ++i)
+    {
+      Chart& c = m_charts.getReference (i);
+      if (c.result)
+      {
+        finished.add (c);
+        c.result = 0;
+      }
+    }
+  }
+
+  for (int i = 0; i < finished.size (); ++i)
+  {
+    const Chart& c = finished.getReference (i);
+    c.chart->setContents (c.result);
+  }
+}
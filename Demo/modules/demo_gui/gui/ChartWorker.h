@@ -0,0 +1,94 @@
+/*******************************************************************************
+
+"A Collection of Useful C++ Classes for Digital Signal Processing"
+ By Vinnie Falco
+
+Official project location:
+https://github.com/vinniefalco/DSPFilters
+
+See Documentation.cpp for contact information, notes, and bibliography.
+
+--------------------------------------------------------------------------------
+
+License: MIT License (http://www.opensource.org/licenses/mit-license.php)
+Copyright (c) 2009 by Vinnie Falco
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+
+*******************************************************************************/
+
+#ifndef DSPDEMO_CHARTWORKER_H
+#define DSPDEMO_CHARTWORKER_H
+
+/*
+ * Calculates the contents of the charts on a background thread.
+ *
+ * The worker has a filter of its own, a snapshot of the one being
+ * edited, so the interface never waits for it. Requests coalesce:
+ * parameters which arrive while a chart is being calculated only
+ * leave it to be calculated once more, for the latest ones, and a
+ * result which was not painted yet is replaced by the newer one.
+ *
+ */
+class ChartWorker
+  : private Thread
+  , private AsyncUpdater
+{
+public:
+  ChartWorker ();
+  ~ChartWorker ();
+
+  void addChart (FilterChart* chart);
+  void removeChart (FilterChart* chart);
+
+  // Takes ownership of a filter of the current design, along
+  // with its parameters. Only the worker uses it from now on.
+  void setFilter (Dsp::Filter* filter);
+
+  void setParams (const Dsp::Params& params);
+
+  // Asks for a chart to be calculated again for new bounds
+  void setBounds (FilterChart* chart, const Rectangle<int>& bounds);
+
+private:
+  struct Chart
+  {
+    FilterChart* chart;
+    Rectangle<int> bounds;
+    bool isDirty;
+    FilterChart::Contents* result;
+  };
+
+  int indexOf (FilterChart* chart) const;
+  void setAllDirty ();
+
+  void run ();
+  void handleAsyncUpdate ();
+
+private:
+  CriticalSection m_mutex;
+  CriticalSection m_calculateMutex;
+  Array<Chart> m_charts;
+  Dsp::Filter* m_newFilter;
+  Dsp::Params m_params;
+  int m_generation;
+  ScopedPointer<Dsp::Filter> m_filter;
+};
+
+#endif
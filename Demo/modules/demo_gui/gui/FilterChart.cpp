@@ -33,10 +33,8 @@ THE SOFTWARE.
 
 *******************************************************************************/
 
-FilterChart::FilterChart (FilterListeners& listeners)
-  : m_listeners (listeners)
-  , m_filter (0)
-  , m_isDefined (false)
+FilterChart::FilterChart (ChartWorker& worker)
+  : m_worker (worker)
 {
   setOpaque (true);
 
@@ -46,12 +44,12 @@ FilterChart::FilterChart (FilterListeners& listeners)
 	m_cAxisMinor  = Colour (0x20000000);
 	m_cText       = Colour (0xd0000000);
 
-  m_listeners.add (this);
+  m_worker.addChart (this);
 }
 
 FilterChart::~FilterChart()
 {
-  m_listeners.remove (this);
+  m_worker.removeChart (this);
 }
 
 void FilterChart::paint (Graphics& g)
@@ -62,7 +60,9 @@ void FilterChart::paint (Graphics& g)
   g.setColour (m_cBack);
 	g.fillRect (r.reduced (1, 1));
 
-  paintContents (g);
+  // nothing to draw until the worker first finishes
+  if (m_contents)
+    paintContents (g);
   paintName (g);
 
   g.setColour (m_cFrame);
@@ -71,19 +71,14 @@ void FilterChart::paint (Graphics& g)
 
 void FilterChart::resized ()
 {
-  update ();
+  m_worker.setBounds (this, getLocalBounds ());
 }
 
-void FilterChart::onFilterChanged (Dsp::Filter* newFilter)
+void FilterChart::setContents (Contents* contents)
 {
-  m_filter = newFilter;
+  m_contents = contents;
 
-  update ();
-}
-
-void FilterChart::onFilterParameters ()
-{
-  update ();
+  repaint ();
 }
 
 const String FilterChart::getName() const
@@ -126,8 +121,8 @@ void FilterChart::paintName (Graphics& g)
 
 //------------------------------------------------------------------------------
 
-FrequencyChart::FrequencyChart (FilterListeners& listeners)
-  : FilterChart (listeners)
+FrequencyChart::FrequencyChart (ChartWorker& worker)
+  : FilterChart (worker)
 {
 }
 
@@ -36,28 +36,44 @@ THE SOFTWARE.
 #ifndef DSPDEMO_FILTERCHART_H
 #define DSPDEMO_FILTERCHART_H
 
+class ChartWorker;
+
 /*
  * Provides some common functionality for displayed charts.
  *
  */
-class FilterChart
-  : public Component
-  , public FilterListener
+class FilterChart : public Component
 {
 public:
-  FilterChart (FilterListeners& listeners);
+  // What the chart draws. Charts which need more than
+  // a path keep the rest in a subclass of their own.
+  struct Contents
+  {
+    Contents () : isDefined (false) { }
+    virtual ~Contents () { }
+
+    bool isDefined;
+    Path path;
+  };
+
+  FilterChart (ChartWorker& worker);
   ~FilterChart ();
 
   void paint (Graphics& g);
 
   void resized ();
 
-  void onFilterChanged (Dsp::Filter* newFilter);
-  void onFilterParameters ();
-
   virtual const String getName() const;
   virtual void paintContents (Graphics& g) = 0;
-  virtual void update () = 0;
+
+  // Calculates the contents for a filter, which may be null, and the
+  // chart's bounds. This is called on the ChartWorker thread, so it
+  // must not touch the component.
+  virtual Contents* calculate (Dsp::Filter* filter,
+                               const Rectangle<int>& bounds) = 0;
+
+  // Takes ownership of calculated contents and repaints
+  void setContents (Contents* contents);
 
   static void drawText (Graphics &g,
                         const Point<int> ptOrigin,
@@ -68,10 +84,8 @@ private:
   void paintName (Graphics& g);
 
 protected:
-  FilterListeners& m_listeners;
-  Dsp::Filter* m_filter;
-  bool m_isDefined;
-  Path m_path;
+  ChartWorker& m_worker;
+  ScopedPointer<Contents> m_contents;
 
   Colour m_cBack;
   Colour m_cFrame;
@@ -87,7 +101,7 @@ protected:
 class FrequencyChart : public FilterChart
 {
 public:
-  FrequencyChart (FilterListeners& listeners);
+  FrequencyChart (ChartWorker& worker);
   ~FrequencyChart ();
 
   void paintOverChildren (Graphics& g);
@@ -33,9 +33,8 @@ THE SOFTWARE.
 
 *******************************************************************************/
 
-GainChart::GainChart (FilterListeners& listeners)
-  : FrequencyChart (listeners)
-  , m_maxDb (0)
+GainChart::GainChart (ChartWorker& worker)
+  : FrequencyChart (worker)
 {
 }
 
@@ -77,7 +76,7 @@ void GainChart::paintContents (Graphics& g)
 
   // path
   g.setColour (Colours::blue);
-  g.strokePath (m_path, 1, t);
+  g.strokePath (m_contents->path, 1, t);
 }
 
 /*
@@ -86,50 +85,54 @@ void GainChart::paintContents (Graphics& g)
  * the y coordinates will be in gain dB
  *
  */
-void GainChart::update ()
+FilterChart::Contents* GainChart::calculate (Dsp::Filter* filter,
+                                             const Rectangle<int>& bounds)
 {
-  m_isDefined = false;
-  m_path.clear();
+  Contents* contents = new Contents;
+  Path& path = contents->path;
+  bool& isDefined = contents->isDefined;
 
-  if (m_filter)
+  if (filter)
   {
-    m_isDefined = true;
+    isDefined = true;
 
-    const Rectangle<int> bounds = getLocalBounds ();
     const Rectangle<int> r = bounds.reduced (4, 4);
 
+    std::vector<double> freq (r.getWidth());
+    std::vector<double> gain (r.getWidth());
+    for (int xi = 0; xi < r.getWidth(); ++xi )
+      freq[xi] = xToF (xi / float(r.getWidth())) / 2.f;
+    if (r.getWidth() > 0)
+      filter->response (Dsp::FrequencyResponse::gainDb,
+                        r.getWidth(), &freq[0], &gain[0]);
+
     for (int xi = 0; xi < r.getWidth(); ++xi )
     {
       float x = xi / float(r.getWidth());
-      float f = xToF (x);
-      Dsp::complex_t c = m_filter->response (f/2.f);
-      float y = float(std::abs(c));
-      if (y < 1e-5f)
-          y = 1e-5f;
-      y = 20 * log10 (y);
+      float y = float(gain[xi]);
+      if (y < -100)
+          y = -100;
 
       if (!Dsp::is_nan (y))
       {
         if (xi == 0)
-          m_path.startNewSubPath (x, y);
+          path.startNewSubPath (x, y);
         else
-          m_path.lineTo (x, y);
+          path.lineTo (x, y);
       }
       else
       {
-        m_path.clear ();
-        m_isDefined = false;
+        path.clear ();
+        isDefined = false;
         break;
       }
     }
 
-    if (m_isDefined)
-      m_path.startNewSubPath (0, 0);
+    if (isDefined)
+      path.startNewSubPath (0, 0);
   }
 
-  m_maxDb = float(floor(m_path.getBounds().getBottom()+0.5));
-
-  repaint();
+  return contents;
 }
 
 bool GainChart::drawDbLine (Graphics& g, int db, bool drawLabel)
@@ -165,7 +168,8 @@ AffineTransform GainChart::calcTransform ()
   const Rectangle<int> bounds = getLocalBounds ();
   const Rectangle<int> r = bounds.reduced (4, 4);
 
-  float maxDb = jmax (m_maxDb, float(kMaxDb));
+  const float pathMaxDb = float(floor(m_contents->path.getBounds().getBottom()+0.5));
+  float maxDb = jmax (pathMaxDb, float(kMaxDb));
 
   AffineTransform t;
 
@@ -49,7 +49,7 @@ public:
     kMinDb = -65
   };
 
-  GainChart (FilterListeners& listeners);
+  GainChart (ChartWorker& worker);
 
   const String getName () const;
 
@@ -57,14 +57,11 @@ public:
 
   void paintContents (Graphics& g);
 
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
+
 private:
-  void update ();
   bool drawDbLine (Graphics& g, int db, bool drawLabel = true);
   AffineTransform calcTransform ();
-
-private:
-  float m_maxDb;
-  Path m_path;
 };
 
 #endif
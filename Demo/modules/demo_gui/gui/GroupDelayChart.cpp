@@ -33,8 +33,8 @@ THE SOFTWARE.
 
 *******************************************************************************/
 
-GroupDelayChart::GroupDelayChart (FilterListeners& listeners)
-  : FilterChart (listeners)
+GroupDelayChart::GroupDelayChart (ChartWorker& worker)
+  : FilterChart (worker)
 {
 }
 
@@ -62,7 +62,7 @@ void GroupDelayChart::paintContents (Graphics& g)
   drawGroupDelayLine (g, -1.f);
 
   g.setColour (Colours::blue);
-  g.strokePath (m_path, 1, t);
+  g.strokePath (m_contents->path, 1, t);
 }
 
 /*
@@ -71,16 +71,17 @@ void GroupDelayChart::paintContents (Graphics& g)
  * the y coordinates will be in seconds
  *
  */
-void GroupDelayChart::update ()
+FilterChart::Contents* GroupDelayChart::calculate (Dsp::Filter* filter,
+                                                   const Rectangle<int>& bounds)
 {
-  m_isDefined = false;
-  m_path.clear();
+  Contents* contents = new Contents;
+  Path& path = contents->path;
+  bool& isDefined = contents->isDefined;
 
-  if (m_filter)
+  if (filter)
   {
-    m_isDefined = true;
+    isDefined = true;
 
-    const Rectangle<int> bounds = getLocalBounds ();
     const Rectangle<int> r = bounds.reduced (4, 4);
 
     // start from 1 to prevent divide by 0
@@ -88,28 +89,28 @@ void GroupDelayChart::update ()
     {
       const float x = xi / float(r.getWidth());
       const float w = float (Dsp::doublePi * (x/2.));
-      const float y = float (-std::abs(m_filter->response (w)) / w);
+      const float y = float (-std::abs(filter->response (w)) / w);
 
       if (!Dsp::is_nan (y))
       {
         if (xi == 1)
-          m_path.startNewSubPath (x, y);
+          path.startNewSubPath (x, y);
         else
-          m_path.lineTo (x, y);
+          path.lineTo (x, y);
       }
       else
       {
-        m_path.clear ();
-        m_isDefined = false;
+        path.clear ();
+        isDefined = false;
         break;
       }
     }
 
-    if (m_isDefined)
-      m_path.startNewSubPath (0, 0);
+    if (isDefined)
+      path.startNewSubPath (0, 0);
   }
 
-  repaint();
+  return contents;
 }
 
 bool GroupDelayChart::drawGroupDelayLine (Graphics& g, float seconds, bool drawLabel)
@@ -43,7 +43,7 @@ THE SOFTWARE.
 class GroupDelayChart : public FilterChart
 {
 public:
-  GroupDelayChart (FilterListeners& listeners);
+  GroupDelayChart (ChartWorker& worker);
 
   const String getName () const;
 
@@ -51,8 +51,9 @@ public:
 
   void paintContents (Graphics& g);
 
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
+
 private:
-  void update ();
   bool drawGroupDelayLine (Graphics& g, float seconds, bool drawLabel = true);
   AffineTransform calcTransform ();
 };
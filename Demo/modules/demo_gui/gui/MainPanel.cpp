@@ -230,42 +230,42 @@ void MainPanel::createCharts (const Rectangle<int>& r)
   const int h2 = h * 2 + gap; //r.getHeight() - (h + gap);
 
   {
-    GainChart* c = new GainChart (m_listeners);
+    GainChart* c = new GainChart (m_chartWorker);
     c->setBounds (r.getX(), r.getY(), w, h);
     addToLayout (c, Point<int>(0, 0), Point<int>(33, 33));
     addAndMakeVisible (c);
   }
 
   {
-    PhaseChart* c = new PhaseChart (m_listeners);
+    PhaseChart* c = new PhaseChart (m_chartWorker);
     c->setBounds (r.getX() + w + gap, r.getY(), w, h);
     addToLayout (c, Point<int>(33, 0), Point<int>(66, 33));
     addAndMakeVisible (c);
   }
 
   {
-    PoleZeroChart* c = new PoleZeroChart (m_listeners);
+    PoleZeroChart* c = new PoleZeroChart (m_chartWorker);
     c->setBounds (r.getX() + w + gap + w + gap, r.getY(), w, h);
     addToLayout (c, Point<int>(66, 0), Point<int>(100, 33));
     addAndMakeVisible (c);
   }
 
   {
-    BrickWallChart* c = new BrickWallChart (m_listeners);
+    BrickWallChart* c = new BrickWallChart (m_chartWorker);
     c->setBounds (r.getX(), r.getY() + h + gap, w2, h2);
     addToLayout (c, Point<int>(0, 33), Point<int>(66, 100));
     addAndMakeVisible (c);
   }
 
   {
-    GroupDelayChart* c = new GroupDelayChart (m_listeners);
+    GroupDelayChart* c = new GroupDelayChart (m_chartWorker);
     c->setBounds (r.getX() + w + gap + w + gap, r.getY() + h + gap, w, h);
     addToLayout (c, Point<int>(66, 33), Point<int>(100, 66));
     addAndMakeVisible (c);
   }
 
   {
-    StepResponseChart* c = new StepResponseChart (m_listeners);
+    StepResponseChart* c = new StepResponseChart (m_chartWorker);
     c->setBounds (r.getX() + w + gap + w + gap, r.getY() + h + gap + h + gap, w, h);
     addToLayout (c, Point<int>(66, 66), Point<int>(100, 100));
     addAndMakeVisible (c);
@@ -381,12 +381,13 @@ void MainPanel::paint (Graphics& g)
 //------------------------------------------------------------------------------
 
 template <class DesignType, class StateType>
-void MainPanel::createFilterDesign (Dsp::Filter** pFilter, Dsp::Filter** pAudioFilter)
+void MainPanel::createFilterDesign (Dsp::Filter** pFilter,
+                                    Dsp::Filter** pAudioFilter)
 {
   switch (m_menuSmoothing->getSelectedId())
   {
   case 1:
-    *pAudioFilter = new Dsp::SmoothedFilterDesign <DesignType, 2, StateType> (1024);
+    *pAudioFilter = new Dsp::SmoothedFilterDesign <DesignType, 2, StateType> (1024, 32);
     break;
 
   default:
@@ -396,9 +397,12 @@ void MainPanel::createFilterDesign (Dsp::Filter** pFilter, Dsp::Filter** pAudioF
 }
 
 template <class DesignType>
-void MainPanel::createFilterState (Dsp::Filter** pFilter, Dsp::Filter** pAudioFilter)
+void MainPanel::createFilterState (Dsp::Filter** pFilter,
+                                   Dsp::Filter** pAudioFilter,
+                                   Dsp::Filter** pChartFilter)
 {
   *pFilter = new Dsp::FilterDesign <DesignType, 1>;
+  *pChartFilter = new Dsp::FilterDesign <DesignType, 1>;
 
   switch (m_menuStateType->getSelectedId())
   {
@@ -415,6 +419,7 @@ void MainPanel::createFilter ()
 {
   Dsp::Filter* f = 0;
   Dsp::Filter* fo = 0;
+  Dsp::Filter* fc = 0;
 
   const int familyId = m_menuFamily->getSelectedId();
   const int typeId = m_menuType->getSelectedId();
@@ -426,15 +431,15 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::RBJ::Design::LowPass> (&f, &fo); break;
-    case 2: createFilterState <Dsp::RBJ::Design::HighPass> (&f, &fo); break;
-    case 3: createFilterState <Dsp::RBJ::Design::BandPass1> (&f, &fo); break;
-    case 4: createFilterState <Dsp::RBJ::Design::BandPass2> (&f, &fo); break;
-    case 5: createFilterState <Dsp::RBJ::Design::BandStop> (&f, &fo); break;
-    case 6: createFilterState <Dsp::RBJ::Design::LowShelf> (&f, &fo); break;
-    case 7: createFilterState <Dsp::RBJ::Design::HighShelf> (&f, &fo); break;
-    case 8: createFilterState <Dsp::RBJ::Design::BandShelf> (&f, &fo); break;
-    case 9: createFilterState <Dsp::RBJ::Design::AllPass> (&f, &fo); break;
+    case 1: createFilterState <Dsp::RBJ::Design::LowPass> (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::RBJ::Design::HighPass> (&f, &fo, &fc); break;
+    case 3: createFilterState <Dsp::RBJ::Design::BandPass1> (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::RBJ::Design::BandPass2> (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::RBJ::Design::BandStop> (&f, &fo, &fc); break;
+    case 6: createFilterState <Dsp::RBJ::Design::LowShelf> (&f, &fo, &fc); break;
+    case 7: createFilterState <Dsp::RBJ::Design::HighShelf> (&f, &fo, &fc); break;
+    case 8: createFilterState <Dsp::RBJ::Design::BandShelf> (&f, &fo, &fc); break;
+    case 9: createFilterState <Dsp::RBJ::Design::AllPass> (&f, &fo, &fc); break;
     };
   }
   //
@@ -444,13 +449,13 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::Butterworth::Design::LowPass   <50> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::Butterworth::Design::HighPass  <50> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::Butterworth::Design::BandPass  <50> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::Butterworth::Design::BandStop  <50> > (&f, &fo); break;
-    case 6: createFilterState <Dsp::Butterworth::Design::LowShelf  <50> > (&f, &fo); break;
-    case 7: createFilterState <Dsp::Butterworth::Design::HighShelf <50> > (&f, &fo); break;
-    case 8: createFilterState <Dsp::Butterworth::Design::BandShelf <50> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::Butterworth::Design::LowPass   <50> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::Butterworth::Design::HighPass  <50> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::Butterworth::Design::BandPass  <50> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::Butterworth::Design::BandStop  <50> > (&f, &fo, &fc); break;
+    case 6: createFilterState <Dsp::Butterworth::Design::LowShelf  <50> > (&f, &fo, &fc); break;
+    case 7: createFilterState <Dsp::Butterworth::Design::HighShelf <50> > (&f, &fo, &fc); break;
+    case 8: createFilterState <Dsp::Butterworth::Design::BandShelf <50> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -460,13 +465,13 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::ChebyshevI::Design::LowPass   <50> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::ChebyshevI::Design::HighPass  <50> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::ChebyshevI::Design::BandPass  <50> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::ChebyshevI::Design::BandStop  <50> > (&f, &fo); break;
-    case 6: createFilterState <Dsp::ChebyshevI::Design::LowShelf  <50> > (&f, &fo); break;
-    case 7: createFilterState <Dsp::ChebyshevI::Design::HighShelf <50> > (&f, &fo); break;
-    case 8: createFilterState <Dsp::ChebyshevI::Design::BandShelf <50> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::ChebyshevI::Design::LowPass   <50> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::ChebyshevI::Design::HighPass  <50> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::ChebyshevI::Design::BandPass  <50> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::ChebyshevI::Design::BandStop  <50> > (&f, &fo, &fc); break;
+    case 6: createFilterState <Dsp::ChebyshevI::Design::LowShelf  <50> > (&f, &fo, &fc); break;
+    case 7: createFilterState <Dsp::ChebyshevI::Design::HighShelf <50> > (&f, &fo, &fc); break;
+    case 8: createFilterState <Dsp::ChebyshevI::Design::BandShelf <50> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -476,13 +481,13 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::ChebyshevII::Design::LowPass   <50> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::ChebyshevII::Design::HighPass  <50> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::ChebyshevII::Design::BandPass  <50> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::ChebyshevII::Design::BandStop  <50> > (&f, &fo); break;
-    case 6: createFilterState <Dsp::ChebyshevII::Design::LowShelf  <50> > (&f, &fo); break;
-    case 7: createFilterState <Dsp::ChebyshevII::Design::HighShelf <50> > (&f, &fo); break;
-    case 8: createFilterState <Dsp::ChebyshevII::Design::BandShelf <50> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::ChebyshevII::Design::LowPass   <50> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::ChebyshevII::Design::HighPass  <50> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::ChebyshevII::Design::BandPass  <50> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::ChebyshevII::Design::BandStop  <50> > (&f, &fo, &fc); break;
+    case 6: createFilterState <Dsp::ChebyshevII::Design::LowShelf  <50> > (&f, &fo, &fc); break;
+    case 7: createFilterState <Dsp::ChebyshevII::Design::HighShelf <50> > (&f, &fo, &fc); break;
+    case 8: createFilterState <Dsp::ChebyshevII::Design::BandShelf <50> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -492,10 +497,10 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::Elliptic::Design::LowPass  <50> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::Elliptic::Design::HighPass <50> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::Elliptic::Design::BandPass <50> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::Elliptic::Design::BandStop <50> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::Elliptic::Design::LowPass  <50> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::Elliptic::Design::HighPass <50> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::Elliptic::Design::BandPass <50> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::Elliptic::Design::BandStop <50> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -505,11 +510,11 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::Bessel::Design::LowPass  <25> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::Bessel::Design::HighPass <25> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::Bessel::Design::BandPass <25> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::Bessel::Design::BandStop <25> > (&f, &fo); break;
-    case 6: createFilterState <Dsp::Bessel::Design::LowShelf <25> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::Bessel::Design::LowPass  <25> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::Bessel::Design::HighPass <25> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::Bessel::Design::BandPass <25> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::Bessel::Design::BandStop <25> > (&f, &fo, &fc); break;
+    case 6: createFilterState <Dsp::Bessel::Design::LowShelf <25> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -519,10 +524,10 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::Legendre::Design::LowPass  <25> > (&f, &fo); break;
-    case 2: createFilterState <Dsp::Legendre::Design::HighPass <25> > (&f, &fo); break;
-    case 4: createFilterState <Dsp::Legendre::Design::BandPass <25> > (&f, &fo); break;
-    case 5: createFilterState <Dsp::Legendre::Design::BandStop <25> > (&f, &fo); break;
+    case 1: createFilterState <Dsp::Legendre::Design::LowPass  <25> > (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::Legendre::Design::HighPass <25> > (&f, &fo, &fc); break;
+    case 4: createFilterState <Dsp::Legendre::Design::BandPass <25> > (&f, &fo, &fc); break;
+    case 5: createFilterState <Dsp::Legendre::Design::BandStop <25> > (&f, &fo, &fc); break;
     };
   }
   //
@@ -532,8 +537,8 @@ void MainPanel::createFilter ()
   {
     switch (typeId)
     {
-    case 1: createFilterState <Dsp::Custom::Design::TwoPole> (&f, &fo); break;
-    case 2: createFilterState <Dsp::Custom::Design::OnePole> (&f, &fo); break;
+    case 1: createFilterState <Dsp::Custom::Design::TwoPole> (&f, &fo, &fc); break;
+    case 2: createFilterState <Dsp::Custom::Design::OnePole> (&f, &fo, &fc); break;
     };
   }
 
@@ -546,6 +551,9 @@ void MainPanel::createFilter ()
    
     m_listeners.call (&FilterListener::onFilterChanged, m_filter);
 
+    fc->setParams (m_filter->getParams ());
+    m_chartWorker.setFilter (fc);
+
     if (fo)
       fo->setParams (m_filter->getParams ());
     MainApp::getInstance().getAudioOutput().setFilter (fo);
@@ -653,6 +661,8 @@ void MainPanel::comboBoxChanged (ComboBox* ctrl)
 
 void MainPanel::onFilterParameters ()
 {
+  m_chartWorker.setParams (m_filter->getParams());
+
   MainApp::getInstance().getAudioOutput().setFilterParameters (
     m_filter->getParams());
 }
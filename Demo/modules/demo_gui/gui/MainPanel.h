@@ -69,15 +69,19 @@ public:
 
 private:
   template <class DesignType, class StateType>
-  void createFilterDesign (Dsp::Filter** pFilter, Dsp::Filter** pAudioFilter);
+  void createFilterDesign (Dsp::Filter** pFilter,
+                           Dsp::Filter** pAudioFilter);
 
   template <class DesignType>
-  void createFilterState (Dsp::Filter** pFilter, Dsp::Filter** pAudioFilter);
+  void createFilterState (Dsp::Filter** pFilter,
+                          Dsp::Filter** pAudioFilter,
+                          Dsp::Filter** pChartFilter);
 
   void createFilter ();
 
 private:
   ListenerList<FilterListener> m_listeners;
+  ChartWorker m_chartWorker;
   ComboBox* m_menuFamily;
   ComboBox* m_menuType;
   ComboBox* m_menuAudio;
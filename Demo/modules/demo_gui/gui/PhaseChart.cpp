@@ -35,8 +35,8 @@ THE SOFTWARE.
 
 //------------------------------------------------------------------------------
 
-PhaseChart::PhaseChart (FilterListeners& listeners)
-  : FilterChart (listeners)
+PhaseChart::PhaseChart (ChartWorker& worker)
+  : FilterChart (worker)
 {
 }
 
@@ -64,7 +64,7 @@ void PhaseChart::paintContents (Graphics& g)
   drawPhaseLine (g, -90);
 
   g.setColour (Colours::blue);
-  g.strokePath (m_path, 1, t);
+  g.strokePath (m_contents->path, 1, t);
 }
 
 /*
@@ -73,44 +73,50 @@ void PhaseChart::paintContents (Graphics& g)
  * the y coordinates will be in phase degrees
  *
  */
-void PhaseChart::update ()
+FilterChart::Contents* PhaseChart::calculate (Dsp::Filter* filter,
+                                              const Rectangle<int>& bounds)
 {
-  m_isDefined = false;
-  m_path.clear();
+  Contents* contents = new Contents;
+  Path& path = contents->path;
+  bool& isDefined = contents->isDefined;
 
-  if (m_filter)
+  if (filter)
   {
-    m_isDefined = true;
+    isDefined = true;
 
-    const Rectangle<int> bounds = getLocalBounds ();
     const Rectangle<int> r = bounds.reduced (4, 4);
 
+    // Evenly spaced from 0 to half the sampling rate
+    std::vector<double> phase (r.getWidth());
+    if (r.getWidth() > 0)
+      filter->response (Dsp::FrequencyResponse::phase, r.getWidth(),
+                        0, 0.5 / r.getWidth(), &phase[0]);
+
     for (int xi = 0; xi < r.getWidth(); ++xi )
     {
       float x = xi / float(r.getWidth());
-      Dsp::complex_t c = m_filter->response (x/2);
-      float y = float (90 * (std::arg(c) / Dsp::doublePi));
+      float y = float (90 * (phase[xi] / Dsp::doublePi));
 
       if (!Dsp::is_nan (y))
       {
         if (xi == 0)
-          m_path.startNewSubPath (x, y);
+          path.startNewSubPath (x, y);
         else
-          m_path.lineTo (x, y);
+          path.lineTo (x, y);
       }
       else
       {
-        m_path.clear ();
-        m_isDefined = false;
+        path.clear ();
+        isDefined = false;
         break;
       }
     }
 
-    if (m_isDefined)
-      m_path.startNewSubPath (0, 0);
+    if (isDefined)
+      path.startNewSubPath (0, 0);
   }
 
-  repaint();
+  return contents;
 }
 
 bool PhaseChart::drawPhaseLine (Graphics& g, int degrees, bool drawLabel)
@@ -49,7 +49,7 @@ public:
     maxPhase = 120
   };
 
-  PhaseChart (FilterListeners& listeners);
+  PhaseChart (ChartWorker& worker);
 
   const String getName () const;
 
@@ -57,13 +57,11 @@ public:
 
   void paintContents (Graphics& g);
 
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
+
 private:
-  void update ();
   bool drawPhaseLine (Graphics& g, int degrees, bool drawLabel = true);
   AffineTransform calcTransform ();
-
-private:
-  Path m_path;
 };
 
 #endif
@@ -33,8 +33,8 @@ THE SOFTWARE.
 
 *******************************************************************************/
 
-PoleZeroChart::PoleZeroChart (FilterListeners& listeners)
-  : FilterChart (listeners)
+PoleZeroChart::PoleZeroChart (ChartWorker& worker)
+  : FilterChart (worker)
 {
 }
 
@@ -45,6 +45,9 @@ const String PoleZeroChart::getName () const
 
 void PoleZeroChart::paintContents (Graphics& g)
 {
+  const PoleZeroContents& contents =
+    *static_cast<PoleZeroContents*> (m_contents.get());
+
   Colour cPole (0xd0ff0000);
   Colour cZero (0xd02020ff);
 	
@@ -57,9 +60,9 @@ void PoleZeroChart::paintContents (Graphics& g)
 
   {
     float margin = 0.2f;
-    if (m_max > 1 + margin)
+    if (contents.max > 1 + margin)
     {
-      t = t.scaled (float(1/(m_max-margin)), float(1/(m_max-margin)));
+      t = t.scaled (float(1/(contents.max-margin)), float(1/(contents.max-margin)));
     }
   }
 
@@ -84,9 +87,9 @@ void PoleZeroChart::paintContents (Graphics& g)
 
   const float r = 3.5f;
 
-  for (size_t i = 0; i < m_vpz.size(); ++i)
+  for (size_t i = 0; i < contents.vpz.size(); ++i)
   {
-    const Dsp::PoleZeroPair& pzp = m_vpz[i];
+    const Dsp::PoleZeroPair& pzp = contents.vpz[i];
 
     if (!pzp.is_nan())
     {
@@ -130,39 +133,40 @@ void PoleZeroChart::paintContents (Graphics& g)
   }
 }
 
-void PoleZeroChart::clear ()
-{
-  m_max = 0;
-  m_vpz.clear();
-}
-
-void PoleZeroChart::update ()
+FilterChart::Contents* PoleZeroChart::calculate (Dsp::Filter* filter,
+                                                 const Rectangle<int>&)
 {
-  clear ();
+  PoleZeroContents* contents = new PoleZeroContents;
 
-  if (m_filter)
-    addPoleZeros (m_filter->getPoleZeros());
+  if (filter)
+  {
+    contents->isDefined = true;
+    addPoleZeros (*contents, filter->getPoleZeros());
+  }
 
-  repaint ();
+  return contents;
 }
 
-void PoleZeroChart::addPoleZeros (const std::vector<Dsp::PoleZeroPair>& vpz)
+void PoleZeroChart::addPoleZeros (PoleZeroContents& contents,
+                                  const std::vector<Dsp::PoleZeroPair>& vpz)
 {
+  double& max = contents.max;
+
   for (size_t i = 0; i < vpz.size(); ++i)
   {
     const Dsp::PoleZeroPair& pzp = vpz[i];
-    m_vpz.push_back (pzp);
+    contents.vpz.push_back (pzp);
 
-    m_max = jmax (m_max, fabs(pzp.poles.first.real()));
-    m_max = jmax (m_max, fabs(pzp.poles.first.imag()));
-    m_max = jmax (m_max, fabs(pzp.zeros.first.real()));
-    m_max = jmax (m_max, fabs(pzp.zeros.first.imag()));
+    max = jmax (max, fabs(pzp.poles.first.real()));
+    max = jmax (max, fabs(pzp.poles.first.imag()));
+    max = jmax (max, fabs(pzp.zeros.first.real()));
+    max = jmax (max, fabs(pzp.zeros.first.imag()));
     if (!pzp.isSinglePole())
     {
-      m_max = jmax (m_max, fabs(pzp.poles.second.real()));
-      m_max = jmax (m_max, fabs(pzp.poles.second.imag()));
-      m_max = jmax (m_max, fabs(pzp.zeros.second.real()));
-      m_max = jmax (m_max, fabs(pzp.zeros.second.imag()));
+      max = jmax (max, fabs(pzp.poles.second.real()));
+      max = jmax (max, fabs(pzp.poles.second.imag()));
+      max = jmax (max, fabs(pzp.zeros.second.real()));
+      max = jmax (max, fabs(pzp.zeros.second.imag()));
     }
   }
 }
@@ -43,20 +43,25 @@ THE SOFTWARE.
 class PoleZeroChart : public FilterChart
 {
 public:
-  PoleZeroChart (FilterListeners& listeners);
+  PoleZeroChart (ChartWorker& worker);
 
   const String getName () const;
 
 	void paintContents (Graphics& g);
 
-private:
-  void clear ();
-  void update ();
-  void addPoleZeros (const std::vector<Dsp::PoleZeroPair>& vpz);
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
 
 private:
-  double m_max;
-  std::vector<Dsp::PoleZeroPair> m_vpz;
+  struct PoleZeroContents : Contents
+  {
+    PoleZeroContents () : max (0) { }
+
+    double max;
+    std::vector<Dsp::PoleZeroPair> vpz;
+  };
+
+  static void addPoleZeros (PoleZeroContents& contents,
+                            const std::vector<Dsp::PoleZeroPair>& vpz);
 };
 
 #endif
@@ -35,9 +35,8 @@ THE SOFTWARE.
 
 //------------------------------------------------------------------------------
 
-StepResponseChart::StepResponseChart (FilterListeners& listeners)
-  : FilterChart (listeners)
-  , m_ymax (1)
+StepResponseChart::StepResponseChart (ChartWorker& worker)
+  : FilterChart (worker)
 {
 }
 
@@ -58,7 +57,7 @@ void StepResponseChart::paintContents (Graphics& g)
   AffineTransform t = calcTransform();
 
   g.setColour (Colours::blue);
-  g.strokePath (m_path, 1, t);
+  g.strokePath (m_contents->path, 1, t);
 }
 
 /*
@@ -66,18 +65,17 @@ void StepResponseChart::paintContents (Graphics& g)
  * the x coordinates will range from 0..1
  *
  */
-void StepResponseChart::update ()
+FilterChart::Contents* StepResponseChart::calculate (Dsp::Filter* filter,
+                                                     const Rectangle<int>& bounds)
 {
-  m_isDefined = false;
-  m_path.clear();
+  Contents* contents = new Contents;
+  Path& path = contents->path;
+  bool& isDefined = contents->isDefined;
 
-  m_ymax = .1f;
-
-  if (m_filter)
+  if (filter)
   {
-    m_filter->reset ();
+    filter->reset ();
 
-    const Rectangle<int> bounds = getLocalBounds ();
     const Rectangle<int> r = bounds.reduced (4, 4);
 
     //int numSamples = r.getWidth ();
@@ -95,7 +93,7 @@ void StepResponseChart::update ()
     for (int i = 3; i < numSamples; ++i)
       impulse[i] = 1;
 #endif
-    m_filter->process (numSamples, &impulse);
+    filter->process (numSamples, &impulse);
 
     // chop off empty tail
     int bigs = 0;
@@ -112,7 +110,7 @@ void StepResponseChart::update ()
     }
     numSamples = jmin (numSamples, int (1.2 * n));
 
-    m_isDefined = true;
+    isDefined = true;
     for (int xi = 0; xi < r.getWidth()-1; ++xi )
     {
       // resample
@@ -126,27 +124,25 @@ void StepResponseChart::update ()
       {
         x /= numSamples;
         if (xi == 0)
-          m_path.startNewSubPath (x, y);
+          path.startNewSubPath (x, y);
         else
-          m_path.lineTo (x, y);
-
-        m_ymax = jmax (float(fabs(y)), float(m_ymax));
+          path.lineTo (x, y);
       }
       else
       {
-        m_path.clear ();
-        m_isDefined = false;
+        path.clear ();
+        isDefined = false;
         break;
       }
     }
 
-    if (m_isDefined)
-      m_path.startNewSubPath (0, 0);
+    if (isDefined)
+      path.startNewSubPath (0, 0);
 
     delete[] impulse;
   }
 
-  repaint();
+  return contents;
 }
 
 AffineTransform StepResponseChart::calcTransform ()
@@ -154,10 +150,14 @@ AffineTransform StepResponseChart::calcTransform ()
   const Rectangle<int> bounds = getLocalBounds ();
   const Rectangle<int> r = bounds.reduced (4, 4);
 
+  // the largest excursion of the response from zero
+  const Rectangle<float> pathBounds = m_contents->path.getBounds ();
+  const float ymax = jmax (-pathBounds.getY(), pathBounds.getBottom(), .1f);
+
   AffineTransform t;
 
   // scale x from 0..1 to 0..getWidth(), flip vertical, scale
-  t = AffineTransform::scale (float(r.getWidth()), -1.f / m_ymax);
+  t = AffineTransform::scale (float(r.getWidth()), -1.f / ymax);
 
   // scale y to fit bounds
   t = t.scaled (1.f, r.getHeight () / 2.1f);
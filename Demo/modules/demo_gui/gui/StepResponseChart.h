@@ -43,7 +43,7 @@ THE SOFTWARE.
 class StepResponseChart : public FilterChart
 {
 public:
-  StepResponseChart (FilterListeners& listeners);
+  StepResponseChart (ChartWorker& worker);
 
   const String getName () const;
 
@@ -51,14 +51,10 @@ public:
 
   void paintContents (Graphics& g);
 
-private:
-  void update ();
-  AffineTransform calcTransform ();
+  Contents* calculate (Dsp::Filter* filter, const Rectangle<int>& bounds);
 
 private:
-  bool m_isDefined;
-  Path m_path;
-  float m_ymax;
+  AffineTransform calcTransform ();
 };
 
 #endif